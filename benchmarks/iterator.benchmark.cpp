@@ -1,11 +1,18 @@
 #include <benchmark/benchmark.h>
+#include <rusty_iterators/hash.hpp>
 #include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
 
+#include <algorithm>
 #include <numeric>
+#include <queue>
 #include <ranges>
+#include <unordered_map>
 
 using ::rusty_iterators::iterator::CycleType;
 using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::mergeSorted;
+using ::rusty_iterators::iterator::range;
 
 constexpr size_t test_elements_amount = 10'000'000;
 
@@ -30,6 +37,17 @@ auto benchmarkRustyIterFilterAndMap(benchmark::State& state) -> void
     }
 }
 
+auto benchmarkRustyIterRangeFilterAndMap(benchmark::State& state) -> void
+{
+    for (auto _ : state)
+    {
+        auto result = range(0, static_cast<int>(test_elements_amount))
+                          .filter([](auto x) { return x % 2 == 0; })
+                          .map([](auto x) { return x * 2; })
+                          .collect();
+    }
+}
+
 auto benchmarkRustyIterFilterMap(benchmark::State& state) -> void
 {
     auto data = initializeIncrementalVector();
@@ -57,6 +75,208 @@ auto benchmarkRangesFilterTransform(benchmark::State& state) -> void
     }
 }
 
+// Spreads the sequential items over 100k keys in random order. A fixed stride
+// would repeat the same sequence of keys on every lap, which favours node based
+// maps, as their nodes are then visited in the order they were allocated.
+auto scrambleKey(int x) -> unsigned
+{
+    return static_cast<unsigned>(rusty_iterators::hashing::mix(x) % 100'000u);
+}
+
+auto benchmarkRustyIterGroupBySum(benchmark::State& state) -> void
+{
+    auto data = initializeIncrementalVector();
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{data}
+                          .groupBy([](auto x) { return scrambleKey(x); })
+                          .sumBy([](auto x) { return static_cast<int64_t>(x); });
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkUnorderedMapGroupSum(benchmark::State& state) -> void
+{
+    auto data = initializeIncrementalVector();
+
+    for (auto _ : state)
+    {
+        auto result = std::unordered_map<unsigned, int64_t>{};
+
+        for (auto x : data)
+            result[scrambleKey(x)] += x;
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkRustyIterHashJoin(benchmark::State& state) -> void
+{
+    auto data = initializeIncrementalVector();
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{data}
+                          .hashJoin(range(0u, 100'000u), [](auto x) { return x; },
+                                    [](auto x) { return scrambleKey(x); })
+                          .count();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkUnorderedMultimapJoin(benchmark::State& state) -> void
+{
+    auto data = initializeIncrementalVector();
+
+    for (auto _ : state)
+    {
+        auto table  = std::unordered_multimap<unsigned, unsigned>{};
+        auto result = size_t{0};
+
+        for (auto x : std::views::iota(0u, 100'000u))
+            table.emplace(x, x);
+
+        for (auto x : data)
+        {
+            auto [first, last] = table.equal_range(scrambleKey(x));
+            result += std::distance(first, last);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+// Splits the items into 256 sorted shards, like time-ordered logs of many hosts.
+auto initializeShards() -> std::vector<std::vector<int>>
+{
+    auto shards = std::vector<std::vector<int>>(256);
+
+    for (int i = 0; i < static_cast<int>(test_elements_amount); i++)
+        shards[scrambleKey(i) % shards.size()].push_back(i);
+
+    return shards;
+}
+
+auto benchmarkRustyIterMergeSorted(benchmark::State& state) -> void
+{
+    auto shards = initializeShards();
+
+    for (auto _ : state)
+    {
+        auto its = std::vector<LazyIterator<std::vector<int>>>{};
+
+        for (auto& shard : shards)
+            its.emplace_back(shard);
+
+        auto result = mergeSorted(std::move(its)).count();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkPriorityQueueMerge(benchmark::State& state) -> void
+{
+    using Head = std::pair<int, size_t>;
+
+    auto shards = initializeShards();
+
+    for (auto _ : state)
+    {
+        auto heads  = std::priority_queue<Head, std::vector<Head>, std::greater<>>{};
+        auto cursor = std::vector<size_t>(shards.size(), 0);
+        auto result = size_t{0};
+
+        for (size_t i = 0; i < shards.size(); i++)
+            heads.emplace(shards[i][0], i);
+
+        while (!heads.empty())
+        {
+            auto [item, shard] = heads.top();
+            heads.pop();
+            result += 1;
+
+            if (++cursor[shard] < shards[shard].size())
+                heads.emplace(shards[shard][cursor[shard]], shard);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto initializeRandomKeys() -> std::vector<uint64_t>
+{
+    auto keys = std::vector<uint64_t>(test_elements_amount);
+    auto seed = uint64_t{1};
+
+    for (auto& key : keys)
+        key = (seed *= 6364136223846793005ull) >> 16;
+
+    return keys;
+}
+
+auto benchmarkRustyIterRadixSortedBy(benchmark::State& state) -> void
+{
+    auto keys = initializeRandomKeys();
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{keys}
+                          .map([](auto x) { return x.get(); })
+                          .radixSortedBy([](auto x) { return x; });
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkStdSort(benchmark::State& state) -> void
+{
+    auto keys = initializeRandomKeys();
+
+    for (auto _ : state)
+    {
+        auto result = keys;
+        std::ranges::sort(result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkRustyIterSortedBy(benchmark::State& state) -> void
+{
+    auto keys = initializeRandomKeys();
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{keys}
+                          .map([](auto x) { return x.get(); })
+                          .sortedBy([](auto x) { return x; })
+                          .collect();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkRustyIterSortedBySpilled(benchmark::State& state) -> void
+{
+    auto keys = initializeRandomKeys();
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{keys}
+                          .map([](auto x) { return x.get(); })
+                          .sortedBy([](auto x) { return x; }, size_t{8} << 20)
+                          .collect();
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkStdStableSort(benchmark::State& state) -> void
+{
+    auto keys = initializeRandomKeys();
+
+    for (auto _ : state)
+    {
+        auto result = keys;
+        std::ranges::stable_sort(result);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
 auto benchmarkRustyIterCopyCycle(benchmark::State& state) -> void
 {
     auto data = std::vector{1, 2, 3};
@@ -79,8 +299,46 @@ auto benchmarkRustyIterCacheCycle(benchmark::State& state) -> void
     }
 }
 
+auto benchmarkRustyIterEqBytes(benchmark::State& state) -> void
+{
+    auto first  = std::vector<uint8_t>(test_elements_amount, 1);
+    auto second = first;
+
+    for (auto _ : state)
+    {
+        auto result = LazyIterator{first}.eq(LazyIterator{second});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+auto benchmarkRangesEqualBytes(benchmark::State& state) -> void
+{
+    auto first  = std::vector<uint8_t>(test_elements_amount, 1);
+    auto second = first;
+
+    for (auto _ : state)
+    {
+        auto result = std::ranges::equal(first, second);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
 BENCHMARK(benchmarkRustyIterFilterAndMap);
+BENCHMARK(benchmarkRustyIterRangeFilterAndMap);
 BENCHMARK(benchmarkRustyIterFilterMap);
 BENCHMARK(benchmarkRangesFilterTransform);
+BENCHMARK(benchmarkRustyIterGroupBySum);
+BENCHMARK(benchmarkUnorderedMapGroupSum);
+BENCHMARK(benchmarkRustyIterHashJoin);
+BENCHMARK(benchmarkUnorderedMultimapJoin);
+BENCHMARK(benchmarkRustyIterMergeSorted);
+BENCHMARK(benchmarkPriorityQueueMerge);
+BENCHMARK(benchmarkRustyIterRadixSortedBy);
+BENCHMARK(benchmarkStdSort);
+BENCHMARK(benchmarkRustyIterSortedBy);
+BENCHMARK(benchmarkRustyIterSortedBySpilled);
+BENCHMARK(benchmarkStdStableSort);
 BENCHMARK(benchmarkRustyIterCopyCycle);
 BENCHMARK(benchmarkRustyIterCacheCycle);
+BENCHMARK(benchmarkRustyIterEqBytes);
+BENCHMARK(benchmarkRangesEqualBytes);
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "async_interface.fwd.hpp"
+#include "task.hpp"
+
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using async::Task;
+using interface::AsyncIterInterface;
+
+template <class T, class Other>
+class AsyncChunks : public AsyncIterInterface<std::vector<T>, AsyncChunks<T, Other>>
+{
+  public:
+    AsyncChunks(Other&& it, size_t size) : it(std::forward<Other>(it)), size(size)
+    {
+        if (size == 0)
+            throw std::length_error{"Chunk size has to be greater than zero."};
+    }
+
+    auto next() -> Task<std::optional<std::vector<T>>>;
+
+  private:
+    Other it;
+    size_t size;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+auto rusty_iterators::iterator::AsyncChunks<T, Other>::next()
+    -> Task<std::optional<std::vector<T>>>
+{
+    auto chunk = std::vector<T>{};
+    chunk.reserve(size);
+
+    while (chunk.size() < size)
+    {
+        auto nextItem = co_await it.next();
+
+        [[unlikely]] if (!nextItem.has_value())
+            break;
+
+        chunk.push_back(std::move(nextItem.value()));
+    }
+
+    // The last chunk might be shorter, but we never return an empty one.
+    [[unlikely]] if (chunk.empty())
+        co_return std::nullopt;
+
+    co_return std::move(chunk);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "async_interface.hpp"
+#include "event_loop.hpp"
+#include "task.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <optional>
+#include <string>
+#include <system_error>
+
+namespace rusty_iterators::iterator
+{
+using async::EventLoop;
+using async::Task;
+using interface::AsyncIterInterface;
+
+/*
+ * Reads delimited records from a file descriptor (pipe, socket, subprocess
+ * output) without blocking the thread. When no data is available, the task
+ * suspends until the event loop reports the descriptor as readable. The
+ * descriptor is switched to non blocking mode, but it is not owned, so the
+ * caller is responsible for closing it.
+ */
+class AsyncFileIterator : public AsyncIterInterface<std::string, AsyncFileIterator>
+{
+  public:
+    explicit AsyncFileIterator(EventLoop& loop, int fd, char delimiter = '\n')
+        : loop(&loop), fd(fd), delimiter(delimiter)
+    {
+        auto flags = fcntl(fd, F_GETFL);
+
+        if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1)
+            throw std::system_error{errno, std::system_category(), "Invalid file descriptor."};
+    }
+
+    auto next() -> Task<std::optional<std::string>>;
+
+  private:
+    static constexpr size_t readSize = 4096;
+
+    EventLoop* loop;
+    int fd;
+    char delimiter;
+    std::string buffer{};
+    size_t head = 0;
+    bool eof    = false;
+
+    auto fill() -> Task<void>;
+};
+} // namespace rusty_iterators::iterator
+
+inline auto rusty_iterators::iterator::AsyncFileIterator::next()
+    -> Task<std::optional<std::string>>
+{
+    while (true)
+    {
+        auto end = buffer.find(delimiter, head);
+
+        if (end != std::string::npos)
+        {
+            auto line = buffer.substr(head, end - head);
+            head      = end + 1;
+            co_return std::move(line);
+        }
+
+        if (eof)
+        {
+            // Same as `std::getline`, the last record doesn't need a delimiter.
+            [[unlikely]] if (head == buffer.size())
+                co_return std::nullopt;
+
+            auto line = buffer.substr(head);
+            head      = buffer.size();
+            co_return std::move(line);
+        }
+        co_await fill();
+    }
+}
+
+inline auto rusty_iterators::iterator::AsyncFileIterator::fill() -> Task<void>
+{
+    buffer.erase(0, head);
+    head = 0;
+
+    auto size = buffer.size();
+    buffer.resize(size + readSize);
+
+    while (true)
+    {
+        auto amount = read(fd, buffer.data() + size, readSize);
+
+        if (amount >= 0)
+        {
+            buffer.resize(size + amount);
+
+            if (amount == 0)
+            {
+                eof = true;
+                loop->forget(fd);
+            }
+            co_return;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            co_await loop->readable(fd);
+        else if (errno != EINTR)
+        {
+            buffer.resize(size);
+            throw std::system_error{errno, std::system_category(), "Could not read descriptor."};
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "async_interface.fwd.hpp"
+#include "concepts.hpp"
+#include "task.hpp"
+
+#include <optional>
+
+namespace rusty_iterators::iterator
+{
+using async::Task;
+using concepts::FilterFunctor;
+using interface::AsyncIterInterface;
+
+template <class T, class Functor, class Other>
+    requires FilterFunctor<T, Functor>
+class AsyncFilter : public AsyncIterInterface<T, AsyncFilter<T, Functor, Other>>
+{
+  public:
+    explicit AsyncFilter(Other&& it, Functor&& f)
+        : it(std::forward<Other>(it)), func(std::forward<Functor>(f)) {};
+
+    auto next() -> Task<std::optional<T>>;
+
+  private:
+    Other it;
+    Functor func;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Functor, class Other>
+    requires rusty_iterators::concepts::FilterFunctor<T, Functor>
+auto rusty_iterators::iterator::AsyncFilter<T, Functor, Other>::next() -> Task<std::optional<T>>
+{
+    auto nextItem = co_await it.next();
+
+    while (nextItem.has_value())
+    {
+        if (func(nextItem.value()))
+            co_return std::move(nextItem);
+
+        nextItem = co_await it.next();
+    }
+    co_return std::nullopt;
+}
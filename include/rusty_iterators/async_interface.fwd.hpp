@@ -0,0 +1,7 @@
+#pragma once
+
+namespace rusty_iterators::interface
+{
+template <class T, class Derived>
+class AsyncIterInterface;
+} // namespace rusty_iterators::interface
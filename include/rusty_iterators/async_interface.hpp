@@ -0,0 +1,182 @@
+#pragma once
+
+#include "async_chunks.hpp"
+#include "async_filter.hpp"
+#include "async_map.hpp"
+#include "async_take.hpp"
+#include "concepts.hpp"
+#include "task.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace rusty_iterators::interface
+{
+using async::Task;
+
+using concepts::FilterFunctor;
+using concepts::FoldFunctor;
+using concepts::ForEachFunctor;
+
+using iterator::AsyncChunks;
+using iterator::AsyncFilter;
+using iterator::AsyncMap;
+using iterator::AsyncTake;
+
+/*
+ * Asynchronous counterpart of `IterInterface`. Every `next()` call returns
+ * a `Task`, which has to be awaited, so sources can suspend while waiting
+ * for data. Terminal operations take ownership of the iterator, because the
+ * returned task usually outlives the expression which created it.
+ */
+template <class T, class Derived>
+class AsyncIterInterface
+{
+  public:
+    using Type = T;
+
+    AsyncIterInterface()          = default;
+    virtual ~AsyncIterInterface() = default;
+
+    AsyncIterInterface(AsyncIterInterface&)                  = default;
+    AsyncIterInterface& operator=(AsyncIterInterface const&) = default;
+    AsyncIterInterface(AsyncIterInterface&&)                 = default;
+    AsyncIterInterface& operator=(AsyncIterInterface&&)      = default;
+
+    [[nodiscard]] auto chunks(size_t size) -> AsyncChunks<T, Derived>;
+    [[nodiscard]] auto collect() -> Task<std::vector<T>>;
+
+    template <class Functor>
+        requires FilterFunctor<T, Functor>
+    [[nodiscard]] auto filter(Functor&& f) -> AsyncFilter<T, Functor, Derived>;
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, T, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> Task<B>;
+
+    template <class Functor>
+        requires ForEachFunctor<T, Functor>
+    [[nodiscard]] auto forEach(Functor&& f) -> Task<void>;
+
+    template <class Functor>
+        requires std::invocable<Functor, T&&>
+    [[nodiscard]] auto map(Functor&& f) -> AsyncMap<T, Functor, Derived>;
+
+    [[nodiscard]] auto take(size_t amount) -> AsyncTake<T, Derived>;
+
+  private:
+    [[nodiscard]] inline auto self() -> Derived& { return static_cast<Derived&>(*this); }
+
+    static auto collectOwned(Derived it) -> Task<std::vector<T>>;
+
+    template <class B, class Functor>
+    static auto foldOwned(Derived it, B init, Functor f) -> Task<B>;
+
+    template <class Functor>
+    static auto forEachOwned(Derived it, Functor f) -> Task<void>;
+};
+} // namespace rusty_iterators::interface
+
+template <class T, class Derived>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::chunks(size_t size)
+    -> AsyncChunks<T, Derived>
+{
+    return AsyncChunks<T, Derived>{std::forward<Derived>(self()), size};
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::collect() -> Task<std::vector<T>>
+{
+    return collectOwned(std::forward<Derived>(self()));
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires rusty_iterators::concepts::FilterFunctor<T, Functor>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::filter(Functor&& f)
+    -> AsyncFilter<T, Functor, Derived>
+{
+    return AsyncFilter<T, Functor, Derived>{std::forward<Derived>(self()),
+                                            std::forward<Functor>(f)};
+}
+
+template <class T, class Derived>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Functor>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::fold(B&& init, Functor&& f)
+    -> Task<B>
+{
+    return foldOwned<std::remove_cvref_t<B>, std::remove_cvref_t<Functor>>(
+        std::forward<Derived>(self()), std::forward<B>(init), std::forward<Functor>(f));
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires rusty_iterators::concepts::ForEachFunctor<T, Functor>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::forEach(Functor&& f) -> Task<void>
+{
+    return forEachOwned<std::remove_cvref_t<Functor>>(std::forward<Derived>(self()),
+                                                      std::forward<Functor>(f));
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<Functor, T&&>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::map(Functor&& f)
+    -> AsyncMap<T, Functor, Derived>
+{
+    return AsyncMap<T, Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(f)};
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::take(size_t amount)
+    -> AsyncTake<T, Derived>
+{
+    return AsyncTake<T, Derived>{std::forward<Derived>(self()), amount};
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::collectOwned(Derived it)
+    -> Task<std::vector<T>>
+{
+    auto collection = std::vector<T>{};
+    auto nextItem   = co_await it.next();
+
+    [[likely]] while (nextItem.has_value())
+    {
+        collection.push_back(std::move(nextItem.value()));
+        nextItem = co_await it.next();
+    }
+    co_return std::move(collection);
+}
+
+template <class T, class Derived>
+template <class B, class Functor>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::foldOwned(Derived it, B init,
+                                                                          Functor f) -> Task<B>
+{
+    auto accum    = std::move(init);
+    auto nextItem = co_await it.next();
+
+    [[likely]] while (nextItem.has_value())
+    {
+        accum    = f(std::move(accum), std::move(nextItem.value()));
+        nextItem = co_await it.next();
+    }
+    co_return std::move(accum);
+}
+
+template <class T, class Derived>
+template <class Functor>
+auto rusty_iterators::interface::AsyncIterInterface<T, Derived>::forEachOwned(Derived it,
+                                                                             Functor f)
+    -> Task<void>
+{
+    auto nextItem = co_await it.next();
+
+    [[likely]] while (nextItem.has_value())
+    {
+        f(std::move(nextItem.value()));
+        nextItem = co_await it.next();
+    }
+}
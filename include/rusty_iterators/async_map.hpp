@@ -0,0 +1,44 @@
+#pragma once
+
+#include "async_interface.fwd.hpp"
+#include "task.hpp"
+
+#include <optional>
+#include <type_traits>
+
+namespace rusty_iterators::iterator
+{
+using async::Task;
+using interface::AsyncIterInterface;
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+class AsyncMap : public AsyncIterInterface<std::invoke_result_t<Functor, Tin>,
+                                           AsyncMap<Tin, Functor, Other>>
+{
+    using Tout = std::invoke_result_t<Functor, Tin>;
+
+  public:
+    explicit AsyncMap(Other&& it, Functor&& f)
+        : it(std::forward<Other>(it)), func(std::forward<Functor>(f)) {};
+
+    auto next() -> Task<std::optional<Tout>>;
+
+  private:
+    Other it;
+    Functor func;
+};
+} // namespace rusty_iterators::iterator
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::AsyncMap<Tin, Functor, Other>::next()
+    -> Task<std::optional<Tout>>
+{
+    auto item = co_await it.next();
+
+    [[likely]] if (item.has_value())
+        co_return func(std::move(item.value()));
+
+    co_return std::nullopt;
+}
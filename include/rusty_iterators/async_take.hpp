@@ -0,0 +1,42 @@
+#pragma once
+
+#include "async_interface.fwd.hpp"
+#include "task.hpp"
+
+#include <optional>
+#include <stdexcept>
+
+namespace rusty_iterators::iterator
+{
+using async::Task;
+using interface::AsyncIterInterface;
+
+template <class T, class Other>
+class AsyncTake : public AsyncIterInterface<T, AsyncTake<T, Other>>
+{
+  public:
+    AsyncTake(Other&& it, size_t size) : it(std::forward<Other>(it)), size(size)
+    {
+        if (size == 0)
+            throw std::length_error{"You have to take at least one item."};
+    }
+
+    auto next() -> Task<std::optional<T>>;
+
+  private:
+    Other it;
+    size_t size;
+    size_t taken = 0;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+auto rusty_iterators::iterator::AsyncTake<T, Other>::next() -> Task<std::optional<T>>
+{
+    // Once we have enough items, we don't wait for the source anymore.
+    if (taken == size)
+        co_return std::nullopt;
+
+    taken += 1;
+    co_return co_await it.next();
+}
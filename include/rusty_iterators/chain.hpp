@@ -1,11 +1,21 @@
 #pragma once
 
+#include "concepts.hpp"
 #include "interface.fwd.hpp"
 
+#include <algorithm>
+#include <concepts>
+#include <functional>
 #include <optional>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
 namespace rusty_iterators::iterator
 {
+using concepts::ExactSize;
+using concepts::FoldFunctor;
+using concepts::ForEachFunctor;
 using interface::IterInterface;
 
 template <class T, class First, class Second>
@@ -25,6 +35,59 @@ class Chain : public IterInterface<T, Chain<T, First, Second>>
     Second second;
     bool useSecond = false;
 };
+
+// Segments of the same type are stored directly, different ones in a variant.
+template <class First, class... Others>
+using ChainSegment = std::conditional_t<(std::same_as<First, Others> && ...), First,
+                                        std::variant<First, Others...>>;
+
+/*
+ * Yields the items of many segments, one segment after another. Unlike the
+ * nested `Chain`s, segments are stored flat, `fold`, `forEach` and `count`
+ * run the own loop of every segment, and `advanceBy` skips segments of an
+ * exactly known size at once.
+ */
+template <class T, class Segment>
+class Concat : public IterInterface<T, Concat<T, Segment>>
+{
+  public:
+    explicit Concat(std::vector<Segment>&& segments) : segments(std::move(segments)) {}
+
+    auto advanceBy(size_t amount) -> void;
+    [[nodiscard]] auto count() -> size_t;
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, T, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
+
+    template <class Functor>
+        requires ForEachFunctor<T, Functor>
+    auto forEach(Functor&& f) -> void;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::vector<Segment> segments;
+    size_t current = 0;
+
+    template <class Other>
+    [[nodiscard]] static auto skip(Other& it, size_t amount) -> size_t;
+
+    template <class Other, class Functor>
+    static auto with(Other& it, Functor&& f) -> decltype(auto);
+    template <class... Others, class Functor>
+    static auto with(std::variant<Others...>& it, Functor&& f) -> decltype(auto);
+    template <class... Others, class Functor>
+    static auto with(const std::variant<Others...>& it, Functor&& f) -> decltype(auto);
+};
+
+// Concatenates a runtime number of iterators of the same type.
+template <class Other>
+[[nodiscard]] auto concat(std::vector<Other> its) -> Concat<typename Other::Type, Other>
+{
+    return Concat<typename Other::Type, Other>{std::move(its)};
+}
 } // namespace rusty_iterators::iterator
 
 template <class T, class First, class Second>
@@ -60,3 +123,134 @@ auto rusty_iterators::iterator::Chain<T, First, Second>::sizeHint() const -> std
 
     return sizeFirst.value() + sizeSecond.value();
 }
+
+template <class T, class Segment>
+auto rusty_iterators::iterator::Concat<T, Segment>::advanceBy(size_t amount) -> void
+{
+    while (amount > 0 && current < segments.size())
+    {
+        amount = with(segments[current], [amount](auto& it) { return skip(it, amount); });
+
+        if (amount > 0)
+            current++;
+    }
+}
+
+template <class T, class Segment>
+auto rusty_iterators::iterator::Concat<T, Segment>::count() -> size_t
+{
+    size_t count = 0;
+
+    for (; current < segments.size(); current++)
+        count += with(segments[current], [](auto& it) { return it.count(); });
+
+    return count;
+}
+
+template <class T, class Segment>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Functor>
+auto rusty_iterators::iterator::Concat<T, Segment>::fold(B&& init, Functor&& f) -> B
+{
+    // Segments get a reference, so a stateful functor is the same object for
+    // all of them.
+    auto func  = std::forward<Functor>(f);
+    auto accum = std::forward<B>(init);
+
+    for (; current < segments.size(); current++)
+    {
+        accum = with(segments[current], [&accum, &func](auto& it) {
+            return it.fold(std::move(accum), std::ref(func));
+        });
+    }
+    return std::move(accum);
+}
+
+template <class T, class Segment>
+template <class Functor>
+    requires rusty_iterators::concepts::ForEachFunctor<T, Functor>
+auto rusty_iterators::iterator::Concat<T, Segment>::forEach(Functor&& f) -> void
+{
+    auto func = std::forward<Functor>(f);
+
+    for (; current < segments.size(); current++)
+        with(segments[current], [&func](auto& it) { it.forEach(std::ref(func)); });
+}
+
+template <class T, class Segment>
+auto rusty_iterators::iterator::Concat<T, Segment>::next() -> std::optional<T>
+{
+    while (current < segments.size())
+    {
+        auto nextItem =
+            with(segments[current], [](auto& it) -> std::optional<T> { return it.next(); });
+
+        [[likely]] if (nextItem.has_value())
+            return std::move(nextItem);
+
+        current++;
+    }
+    return std::nullopt;
+}
+
+template <class T, class Segment>
+auto rusty_iterators::iterator::Concat<T, Segment>::sizeHint() const -> std::optional<size_t>
+{
+    // Same as `Chain`, a single infinite segment makes the whole thing infinite.
+    size_t size = 0;
+
+    for (auto idx = current; idx < segments.size(); idx++)
+    {
+        auto segmentSize = with(segments[idx], [](const auto& it) { return it.sizeHint(); });
+
+        if (!segmentSize.has_value())
+            return std::nullopt;
+
+        size += segmentSize.value();
+    }
+    return size;
+}
+
+template <class T, class Segment>
+template <class Other>
+auto rusty_iterators::iterator::Concat<T, Segment>::skip(Other& it, size_t amount) -> size_t
+{
+    // Returns how much is still left to skip after this segment.
+    if constexpr (ExactSize<Other>)
+    {
+        auto step = std::min(amount, it.sizeHint().value());
+        it.advanceBy(step);
+
+        return amount - step;
+    }
+    else
+    {
+        while (amount > 0 && it.next().has_value())
+            amount--;
+
+        return amount;
+    }
+}
+
+template <class T, class Segment>
+template <class Other, class Functor>
+auto rusty_iterators::iterator::Concat<T, Segment>::with(Other& it, Functor&& f) -> decltype(auto)
+{
+    return f(it);
+}
+
+template <class T, class Segment>
+template <class... Others, class Functor>
+auto rusty_iterators::iterator::Concat<T, Segment>::with(std::variant<Others...>& it, Functor&& f)
+    -> decltype(auto)
+{
+    return std::visit(std::forward<Functor>(f), it);
+}
+
+template <class T, class Segment>
+template <class... Others, class Functor>
+auto rusty_iterators::iterator::Concat<T, Segment>::with(const std::variant<Others...>& it,
+                                                         Functor&& f) -> decltype(auto)
+{
+    return std::visit(std::forward<Functor>(f), it);
+}
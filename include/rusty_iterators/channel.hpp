@@ -0,0 +1,323 @@
+#pragma once
+
+#include "event_count.hpp"
+#include "spsc_ring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace rusty_iterators::concurrency
+{
+/*
+ * Bounded channel between exactly one sending and one receiving thread.
+ *
+ * Sending blocks while the channel is full and fails once the receiver
+ * cancelled it. Receiving blocks while the channel is empty and stops once
+ * the sender closed it and every item was received.
+ */
+template <class T>
+class SpscChannel
+{
+  public:
+    using value_type = T;
+
+    explicit SpscChannel(size_t capacity) : ring(capacity) {}
+
+    auto cancel() -> void { ring.cancel(); }
+    auto close() -> void { ring.close(); }
+    [[nodiscard]] auto isClosed() const -> bool { return ring.isClosed(); }
+
+    [[nodiscard]] auto receive() -> std::optional<T> { return ring.pop(); }
+    auto receiveBatch(std::vector<T>& out, size_t limit) -> size_t
+    {
+        return ring.popMany(out, limit);
+    }
+
+    [[nodiscard]] auto send(T&& item) -> bool { return ring.push(std::move(item)); }
+    auto sendBatch(std::span<T> items) -> size_t { return ring.pushMany(items); }
+
+  private:
+    SpscRing<T> ring;
+};
+
+/*
+ * Bounded channel shared by any number of sending and receiving threads,
+ * based on the array queue by Dmitry Vyukov. Every cell carries a sequence
+ * number telling if it's ready to be written or read in the current lap, so
+ * both sides need a single compare and swap to claim a whole batch of cells.
+ *
+ * Closing the channel makes further sends fail, while receivers still get
+ * the items which were sent before. It should be closed once every sender
+ * has finished.
+ */
+template <class T>
+class MpmcChannel
+{
+  public:
+    using value_type = T;
+
+    explicit MpmcChannel(size_t capacity);
+
+    auto close() -> void;
+    [[nodiscard]] auto isClosed() const -> bool { return closed.load(std::memory_order_acquire); }
+
+    [[nodiscard]] auto receive() -> std::optional<T>;
+    auto receiveBatch(std::vector<T>& out, size_t limit) -> size_t;
+
+    [[nodiscard]] auto send(T&& item) -> bool;
+    auto sendBatch(std::span<T> items) -> size_t;
+
+    [[nodiscard]] auto tryReceive() -> std::optional<T>;
+    auto tryReceiveBatch(std::vector<T>& out, size_t limit) -> size_t;
+    auto trySendBatch(std::span<T> items) -> size_t;
+
+  private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        std::optional<T> value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    alignas(cacheLineSize) std::atomic<size_t> enqueuePos = 0;
+    alignas(cacheLineSize) std::atomic<size_t> dequeuePos = 0;
+    alignas(cacheLineSize) std::atomic<bool> closed       = false;
+
+    EventCount notEmpty{};
+    EventCount notFull{};
+
+    struct Claim
+    {
+        size_t pos;
+        size_t amount;
+    };
+
+    // Producers wait for cells with the sequence equal to their position,
+    // consumers for cells one step ahead of it.
+    static constexpr size_t writable = 0;
+    static constexpr size_t readable = 1;
+
+    [[nodiscard]] auto claim(std::atomic<size_t>& position, size_t limit, size_t lag) -> Claim;
+    [[nodiscard]] auto claimable(size_t pos, size_t limit, size_t lag) const -> size_t;
+    [[nodiscard]] auto take(size_t pos) -> T;
+
+    template <class Attempt>
+    [[nodiscard]] auto receiveWith(Attempt&& attempt) -> std::invoke_result_t<Attempt>;
+};
+} // namespace rusty_iterators::concurrency
+
+template <class T>
+rusty_iterators::concurrency::MpmcChannel<T>::MpmcChannel(size_t capacity)
+{
+    if (capacity == 0)
+        throw std::length_error{"Channel capacity has to be greater than zero."};
+
+    // Sequence numbers of a single cell would be ambiguous between laps.
+    capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+    cells    = std::make_unique<Cell[]>(capacity);
+    mask     = capacity - 1;
+
+    for (size_t i = 0; i < capacity; i++)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::close() -> void
+{
+    closed.store(true, std::memory_order_release);
+
+    notEmpty.notifyAll();
+    notFull.notifyAll();
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::receive() -> std::optional<T>
+{
+    return receiveWith([this] { return tryReceive(); });
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::receiveBatch(std::vector<T>& out, size_t limit)
+    -> size_t
+{
+    return receiveWith([this, &out, limit] { return tryReceiveBatch(out, limit); });
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::send(T&& item) -> bool
+{
+    return sendBatch(std::span<T>{&item, 1}) == 1;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::sendBatch(std::span<T> items) -> size_t
+{
+    size_t sent = 0;
+
+    while (sent < items.size() && !isClosed())
+    {
+        auto amount = trySendBatch(items.subspan(sent));
+
+        [[likely]] if (amount > 0)
+        {
+            sent += amount;
+            continue;
+        }
+        auto key = notFull.prepareWait();
+        amount   = trySendBatch(items.subspan(sent));
+
+        if (amount > 0 || isClosed())
+        {
+            notFull.cancelWait();
+            sent += amount;
+            continue;
+        }
+        notFull.wait(key);
+    }
+    return sent;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::tryReceive() -> std::optional<T>
+{
+    auto [pos, amount] = claim(dequeuePos, 1, readable);
+
+    [[unlikely]] if (amount == 0)
+        return std::nullopt;
+
+    auto item = take(pos);
+    notFull.notifyAll();
+
+    return item;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::tryReceiveBatch(std::vector<T>& out,
+                                                                   size_t limit) -> size_t
+{
+    auto [pos, amount] = claim(dequeuePos, limit, readable);
+
+    [[unlikely]] if (amount == 0)
+        return 0;
+
+    for (size_t i = 0; i < amount; i++)
+        out.push_back(take(pos + i));
+
+    notFull.notifyAll();
+
+    return amount;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::trySendBatch(std::span<T> items) -> size_t
+{
+    auto [pos, amount] = claim(enqueuePos, items.size(), writable);
+
+    [[unlikely]] if (amount == 0)
+        return 0;
+
+    for (size_t i = 0; i < amount; i++)
+    {
+        auto& cell = cells[(pos + i) & mask];
+
+        cell.value.emplace(std::move(items[i]));
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    notEmpty.notifyAll();
+
+    return amount;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::claim(std::atomic<size_t>& position,
+                                                         size_t limit, size_t lag) -> Claim
+{
+    auto pos = position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        auto amount = claimable(pos, limit, lag);
+
+        if (amount == 0)
+        {
+            // Either the channel is full (empty), or other thread has already
+            // claimed this position and we have to catch up.
+            auto current = position.load(std::memory_order_relaxed);
+
+            if (current == pos)
+                return Claim{pos, 0};
+
+            pos = current;
+        }
+        else if (position.compare_exchange_weak(pos, pos + amount, std::memory_order_relaxed))
+            return Claim{pos, amount};
+    }
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::claimable(size_t pos, size_t limit,
+                                                             size_t lag) const -> size_t
+{
+    // Cells are released out of order by concurrent threads, so we can only
+    // claim the prefix of the batch which is ready in the current lap.
+    limit = std::min(limit, mask + 1);
+
+    for (size_t i = 0; i < limit; i++)
+    {
+        auto sequence = cells[(pos + i) & mask].sequence.load(std::memory_order_acquire);
+
+        if (sequence != pos + i + lag)
+            return i;
+    }
+    return limit;
+}
+
+template <class T>
+template <class Attempt>
+auto rusty_iterators::concurrency::MpmcChannel<T>::receiveWith(Attempt&& attempt)
+    -> std::invoke_result_t<Attempt>
+{
+    while (true)
+    {
+        auto result = attempt();
+
+        [[likely]] if (result)
+            return result;
+
+        auto key = notEmpty.prepareWait();
+
+        // Closing happens after the last send, so one more attempt is enough
+        // to collect everything which is still in the channel.
+        auto wasClosed = isClosed();
+        result         = attempt();
+
+        if (result || wasClosed)
+        {
+            notEmpty.cancelWait();
+            return result;
+        }
+        notEmpty.wait(key);
+    }
+}
+
+template <class T>
+auto rusty_iterators::concurrency::MpmcChannel<T>::take(size_t pos) -> T
+{
+    auto& cell = cells[pos & mask];
+    auto item  = std::move(cell.value.value());
+
+    cell.value.reset();
+    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+
+    return item;
+}
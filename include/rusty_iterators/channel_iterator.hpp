@@ -0,0 +1,57 @@
+#pragma once
+
+#include "interface.hpp"
+
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+
+/*
+ * Yields items received from a channel until it gets closed. The channel is
+ * shared with other threads, so it has to outlive the iterator.
+ */
+template <class Channel>
+class ChannelIterator
+    : public IterInterface<typename Channel::value_type, ChannelIterator<Channel>>
+{
+    using T = typename Channel::value_type;
+
+  public:
+    explicit ChannelIterator(Channel& channel, size_t batchSize = 64)
+        : channel(&channel), batchSize(batchSize)
+    {
+        if (batchSize == 0)
+            throw std::length_error{"Batch size has to be greater than zero."};
+
+        buffer.reserve(batchSize);
+    }
+
+    auto next() -> std::optional<T>
+    {
+        // Items are received in batches, to synchronize with senders once per
+        // batch instead of once per item.
+        [[unlikely]] if (position == buffer.size())
+        {
+            buffer.clear();
+            position = 0;
+
+            [[unlikely]] if (channel->receiveBatch(buffer, batchSize) == 0)
+                return std::nullopt;
+        }
+        return std::move(buffer[position++]);
+    }
+
+    // Same as for lazy file reading, we can't know how many items will come.
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return 0; }
+
+  private:
+    Channel* channel;
+    size_t batchSize;
+    std::vector<T> buffer{};
+    size_t position = 0;
+};
+} // namespace rusty_iterators::iterator
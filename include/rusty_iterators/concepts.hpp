@@ -1,8 +1,14 @@
 #pragma once
 
+#include <concepts>
+#include <cstdint>
 #include <expected>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace rusty_iterators::concepts
 {
@@ -14,12 +20,34 @@ concept AllFunctor = requires(Functor f, T&& t) {
 template <class T, class Functor>
 concept AnyFunctor = AllFunctor<T, Functor>;
 
+template <class T>
+concept TriviallyComparable = std::is_scalar_v<T> && std::has_unique_object_representations_v<T>;
+
+template <class T>
+concept ByteLike = TriviallyComparable<T> && sizeof(T) == 1;
+
+template <class C, class T>
+concept ChannelOf = std::convertible_to<T, typename C::value_type> &&
+                    requires(C c, std::span<typename C::value_type> items) {
+                        { c.sendBatch(items) } -> std::same_as<size_t>;
+                    };
+
 template <class T>
 concept Comparable = requires(T first, T second) {
     { first > second } -> std::same_as<bool>;
     { first < second } -> std::same_as<bool>;
 };
 
+template <class I, class T>
+concept ContiguousOf = requires(I it) {
+    { it.asSlice() } -> std::same_as<std::span<const T>>;
+};
+
+template <class T, class V>
+concept EqualityComparableTo = requires(T t, const V& v) {
+    { t == v } -> std::convertible_to<bool>;
+};
+
 template <class T, class Functor>
 concept EqFunctor = requires(Functor f, std::tuple<T, T> t) {
     { f(t) } -> std::same_as<bool>;
@@ -28,6 +56,9 @@ concept EqFunctor = requires(Functor f, std::tuple<T, T> t) {
 template <class T, class Functor>
 concept NeFunctor = EqFunctor<T, Functor>;
 
+template <class T>
+concept Numeric = std::is_arithmetic_v<T>;
+
 template <class T, class Functor>
 concept FilterFunctor = AllFunctor<T&, Functor>;
 
@@ -36,6 +67,28 @@ concept FilterMapFunctor = requires(Functor f, Tin&& t) {
     { f(t) } -> std::same_as<std::optional<Tout>>;
 };
 
+template <class T>
+concept IteratorLike = requires(T t) {
+    typename T::Type;
+    { t.next() } -> std::same_as<std::optional<typename T::Type>>;
+    { std::as_const(t).sizeHint() } -> std::same_as<std::optional<size_t>>;
+};
+
+// Functions of `flatMap` return an iterator or a range, directly or through a
+// reference wrapper.
+template <class T, class Functor>
+concept FlatMapFunctor =
+    std::invocable<Functor&, T&&> &&
+    (IteratorLike<std::remove_cvref_t<std::invoke_result_t<Functor&, T&&>>> ||
+     std::ranges::input_range<
+         std::unwrap_reference_t<std::remove_cvref_t<std::invoke_result_t<Functor&, T&&>>>>);
+
+template <class Other, class Functor>
+concept FlatMapGenFunctor = requires(Functor f, Other&& it) {
+    typename std::invoke_result_t<Functor, Other>::promise_type;
+    typename std::invoke_result_t<Functor, Other>::Type;
+};
+
 template <class B, class T, class Functor>
 concept FoldFunctor = requires(Functor f, B&& accumulator, T&& item) {
     { f(accumulator, item) } -> std::same_as<B>;
@@ -46,6 +99,21 @@ concept ForEachFunctor = requires(Functor f, T t) {
     { f(t) } -> std::same_as<void>;
 };
 
+template <class T, class Functor>
+concept HashFunctor = requires(const Functor f, const T& t) {
+    { f(t) } -> std::convertible_to<uint64_t>;
+};
+
+// Iterators whose size hint is the exact number of the remaining items.
+template <class T>
+concept ExactSize = requires {
+    requires T::exactSize;
+};
+
+template <class C, class T>
+concept Extendable = requires(C c, T&& t) { c.push_back(std::forward<T>(t)); } ||
+                     requires(C c, T&& t) { c.insert(c.end(), std::forward<T>(t)); };
+
 template <class T>
 concept Indexable = requires(T t) {
     typename T::value_type;
@@ -57,9 +125,19 @@ concept InspectFunctor = requires(Functor f, T& t) {
     { f(t) } -> std::same_as<void>;
 };
 
+template <class T, class B, class ProbeKey, class BuildKey>
+concept JoinFunctors = std::invocable<ProbeKey&, T&> && std::invocable<BuildKey&, B&> &&
+                       std::convertible_to<std::invoke_result_t<ProbeKey&, T&>,
+                                           std::remove_cvref_t<std::unwrap_reference_t<
+                                               std::invoke_result_t<BuildKey&, B&>>>>;
+
 template <class T, class Functor>
 concept PositionFunctor = AllFunctor<T, Functor>;
 
+template <class T>
+concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) ||
+                   (std::floating_point<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
 template <class T>
 concept Multiplyable = requires(T first, T second) {
     { first* second } -> std::same_as<T>;
@@ -68,6 +146,16 @@ concept Multiplyable = requires(T first, T second) {
 template <class T, class Functor>
 concept ReduceFunctor = FoldFunctor<T, T, Functor>;
 
+template <class T>
+concept Subtractable = requires(T first, T second) {
+    { first - second } -> std::same_as<T>;
+};
+
+template <class T, class Functor>
+concept SuccessorFunctor = requires(Functor f, const T& t) {
+    { f(t) } -> std::same_as<std::optional<T>>;
+};
+
 template <class T>
 concept Summable = requires(T first, T second) {
     { first + second } -> std::same_as<T>;
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+
+/*
+ * Collapses runs of consecutive items with equal keys into their first item.
+ * On a sorted iterator, e.g. the result of `mergeSorted`, this removes all
+ * the duplicates.
+ */
+template <class T, class Key, class Other>
+class Dedup : public IterInterface<T, Dedup<T, Key, Other>>
+{
+  public:
+    explicit Dedup(Other&& it, Key&& key) : it(std::forward<Other>(it)), key(std::forward<Key>(key))
+    {}
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    Key key;
+    std::optional<T> previous = std::nullopt;
+
+    [[nodiscard]] auto isDuplicate(const T& item) const -> bool;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Key, class Other>
+auto rusty_iterators::iterator::Dedup<T, Key, Other>::next() -> std::optional<T>
+{
+    auto nextItem = it.next();
+
+    while (nextItem.has_value() && isDuplicate(nextItem.value()))
+        nextItem = it.next();
+
+    if (nextItem.has_value())
+        previous = nextItem;
+
+    return nextItem;
+}
+
+template <class T, class Key, class Other>
+auto rusty_iterators::iterator::Dedup<T, Key, Other>::sizeHint() const -> std::optional<size_t>
+{
+    // Same as filter, it is better to overallocate.
+    return it.sizeHint();
+}
+
+template <class T, class Key, class Other>
+auto rusty_iterators::iterator::Dedup<T, Key, Other>::isDuplicate(const T& item) const -> bool
+{
+    using K = std::remove_cvref_t<
+        std::unwrap_reference_t<std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>>>;
+
+    if (!previous.has_value())
+        return false;
+
+    const auto& a = std::invoke(key, previous.value());
+    const auto& b = std::invoke(key, item);
+
+    return static_cast<const K&>(a) == static_cast<const K&>(b);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "spsc_ring.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace rusty_iterators::concurrency
+{
+/*
+ * Lets lock-free structures block without making the fast path slower. A
+ * waiter announces itself with `prepareWait`, checks its condition once more
+ * and then either cancels or waits. Notifiers touch the shared counter only
+ * when somebody actually waits.
+ */
+class EventCount
+{
+  public:
+    using Key = uint32_t;
+
+    auto cancelWait() -> void;
+    auto notifyAll() -> void;
+    [[nodiscard]] auto prepareWait() -> Key;
+    auto wait(Key key) -> void;
+
+  private:
+    alignas(cacheLineSize) std::atomic<Key> epoch = 0;
+    std::atomic<uint32_t> waiters                 = 0;
+};
+} // namespace rusty_iterators::concurrency
+
+inline auto rusty_iterators::concurrency::EventCount::cancelWait() -> void
+{
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline auto rusty_iterators::concurrency::EventCount::notifyAll() -> void
+{
+    // Pairs with the fence in `prepareWait`, either we see the waiter or the
+    // waiter sees the state we have just published.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    [[likely]] if (waiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    epoch.fetch_add(1, std::memory_order_release);
+    epoch.notify_all();
+}
+
+inline auto rusty_iterators::concurrency::EventCount::prepareWait() -> Key
+{
+    waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return epoch.load(std::memory_order_acquire);
+}
+
+inline auto rusty_iterators::concurrency::EventCount::wait(Key key) -> void
+{
+    epoch.wait(key, std::memory_order_acquire);
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+}
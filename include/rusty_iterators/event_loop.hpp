@@ -0,0 +1,284 @@
+#pragma once
+
+#include "frame_pool.hpp"
+#include "task.hpp"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace rusty_iterators::async
+{
+using coroutine::FramePool;
+
+/*
+ * Minimal single threaded event loop built on top of `epoll`. Spawned tasks
+ * run until they have to wait for a file descriptor, so a single thread can
+ * multiplex many stream pipelines.
+ */
+class EventLoop
+{
+  public:
+    class ReadableAwaiter;
+
+    EventLoop();
+    ~EventLoop();
+
+    EventLoop(const EventLoop&)                    = delete;
+    auto operator=(const EventLoop&) -> EventLoop& = delete;
+    EventLoop(EventLoop&&)                         = delete;
+    auto operator=(EventLoop&&) -> EventLoop&      = delete;
+
+    auto forget(int fd) -> void;
+
+    // Suspends the awaiting task until `fd` is readable. A descriptor can
+    // only have a single waiter at a time, awaiting one which already has
+    // a waiter throws `std::logic_error` in the second task.
+    [[nodiscard]] auto readable(int fd) -> ReadableAwaiter;
+    auto run() -> void;
+
+    template <class T>
+    auto runUntilComplete(Task<T> task) -> T;
+
+    auto spawn(Task<void> task) -> void;
+
+  private:
+    class Detached;
+
+    static constexpr int maxEvents = 64;
+
+    int epollFd;
+    std::deque<std::coroutine_handle<>> ready{};
+    std::unordered_map<int, std::coroutine_handle<>> waiters{};
+    std::unordered_set<int> registered{};
+    std::unordered_set<void*> tasks{};
+    std::exception_ptr error = nullptr;
+
+    static auto drive(EventLoop& loop, Task<void> task) -> Detached;
+
+    template <class T>
+    static auto store(Task<T> task, std::optional<T>& result) -> Task<void>;
+
+    auto poll() -> void;
+    auto watch(int fd, std::coroutine_handle<> handle) -> void;
+};
+
+class EventLoop::ReadableAwaiter
+{
+  public:
+    ReadableAwaiter(EventLoop& loop, int fd) : loop(&loop), fd(fd) {}
+
+    [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+    auto await_suspend(std::coroutine_handle<> handle) const -> void { loop->watch(fd, handle); }
+    auto await_resume() const noexcept -> void {}
+
+  private:
+    EventLoop* loop;
+    int fd;
+};
+
+// Root of a spawned task, which removes itself from the loop when finished.
+class EventLoop::Detached
+{
+  public:
+    class promise_type
+    {
+      public:
+        promise_type(EventLoop& loop, Task<void>& /*unused*/) : loop(&loop) {}
+
+        struct FinalAwaiter
+        {
+            [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+            auto await_resume() const noexcept -> void {}
+
+            auto await_suspend(std::coroutine_handle<promise_type> handle) const noexcept -> void
+            {
+                handle.promise().loop->tasks.erase(handle.address());
+                handle.destroy();
+            }
+        };
+
+        [[nodiscard]] auto get_return_object() -> Detached
+        {
+            return Detached{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+        [[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter { return {}; }
+
+        auto return_void() -> void {}
+        auto unhandled_exception() -> void { std::terminate(); }
+
+        [[nodiscard]] static auto operator new(size_t size) -> void*
+        {
+            return FramePool::allocate(size);
+        }
+        static auto operator delete(void* ptr, size_t size) noexcept -> void
+        {
+            FramePool::deallocate(ptr, size);
+        }
+
+      private:
+        EventLoop* loop;
+    };
+
+    explicit Detached(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    std::coroutine_handle<promise_type> handle;
+};
+} // namespace rusty_iterators::async
+
+inline rusty_iterators::async::EventLoop::EventLoop() : epollFd(epoll_create1(EPOLL_CLOEXEC))
+{
+    if (epollFd == -1)
+        throw std::system_error{errno, std::system_category(), "Could not create epoll instance."};
+}
+
+inline rusty_iterators::async::EventLoop::~EventLoop()
+{
+    // Tasks which never finished are destroyed together with everything they
+    // are currently awaiting.
+    for (auto* task : tasks)
+        std::coroutine_handle<>::from_address(task).destroy();
+
+    close(epollFd);
+}
+
+inline auto rusty_iterators::async::EventLoop::forget(int fd) -> void
+{
+    [[likely]] if (registered.erase(fd) > 0)
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+    waiters.erase(fd);
+}
+
+inline auto rusty_iterators::async::EventLoop::readable(int fd) -> ReadableAwaiter
+{
+    return ReadableAwaiter{*this, fd};
+}
+
+inline auto rusty_iterators::async::EventLoop::run() -> void
+{
+    while (!tasks.empty())
+    {
+        while (!ready.empty())
+        {
+            auto handle = ready.front();
+            ready.pop_front();
+            handle.resume();
+        }
+
+        if (tasks.empty())
+            break;
+
+        if (waiters.empty())
+            throw std::logic_error{"Tasks are suspended, but none of them waits for any event."};
+
+        poll();
+    }
+
+    if (error)
+        std::rethrow_exception(std::exchange(error, nullptr));
+}
+
+template <class T>
+auto rusty_iterators::async::EventLoop::runUntilComplete(Task<T> task) -> T
+{
+    if constexpr (std::is_void_v<T>)
+    {
+        spawn(std::move(task));
+        run();
+    }
+    else
+    {
+        auto result = std::optional<T>{};
+
+        spawn(store(std::move(task), result));
+        run();
+
+        return std::move(result.value());
+    }
+}
+
+inline auto rusty_iterators::async::EventLoop::spawn(Task<void> task) -> void
+{
+    auto detached = drive(*this, std::move(task));
+
+    tasks.insert(detached.handle.address());
+    ready.push_back(detached.handle);
+}
+
+inline auto rusty_iterators::async::EventLoop::drive(EventLoop& loop, Task<void> task) -> Detached
+{
+    try
+    {
+        co_await task;
+    }
+    catch (...)
+    {
+        // Only the first failure is reported, it's most likely the cause.
+        if (!loop.error)
+            loop.error = std::current_exception();
+    }
+}
+
+template <class T>
+auto rusty_iterators::async::EventLoop::store(Task<T> task, std::optional<T>& result) -> Task<void>
+{
+    result.emplace(co_await task);
+}
+
+inline auto rusty_iterators::async::EventLoop::poll() -> void
+{
+    auto events = std::array<epoll_event, maxEvents>{};
+    auto amount = epoll_wait(epollFd, events.data(), maxEvents, -1);
+
+    if (amount == -1)
+    {
+        if (errno == EINTR)
+            return;
+
+        throw std::system_error{errno, std::system_category(), "Waiting for events failed."};
+    }
+
+    for (const auto& event : std::span{events}.first(amount))
+    {
+        auto waiter = waiters.extract(event.data.fd);
+
+        if (!waiter.empty())
+            ready.push_back(waiter.mapped());
+    }
+}
+
+inline auto rusty_iterators::async::EventLoop::watch(int fd, std::coroutine_handle<> handle) -> void
+{
+    // Resuming only one of the waiters would leave the other one suspended
+    // forever, so it's better to fail the task which came second.
+    if (waiters.contains(fd))
+        throw std::logic_error{"The descriptor is already awaited by another task."};
+
+    // One shot registrations are rearmed with a single syscall on every wait.
+    auto event    = epoll_event{};
+    event.events  = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.fd = fd;
+
+    auto operation = registered.contains(fd) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+    if (epoll_ctl(epollFd, operation, fd, &event) == -1)
+        throw std::system_error{errno, std::system_category(), "Could not watch the descriptor."};
+
+    registered.insert(fd);
+    waiters.emplace(fd, handle);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+#include "sketches.hpp"
+
+#include <functional>
+#include <optional>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+using statistics::BloomFilter;
+
+/*
+ * Drops the items whose keys are certainly not in the filter. The filter is
+ * borrowed, it has to outlive the iterator, and the hasher has to be the one
+ * the filter was built with.
+ */
+template <class T, class Functor, class Hasher, class Other>
+class FilterMaybeIn : public IterInterface<T, FilterMaybeIn<T, Functor, Hasher, Other>>
+{
+  public:
+    explicit FilterMaybeIn(Other&& it, const BloomFilter& bloom, Functor&& key, Hasher hasher)
+        : it(std::forward<Other>(it)), bloom(&bloom), key(std::forward<Functor>(key)),
+          hasher(std::move(hasher))
+    {}
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    const BloomFilter* bloom;
+    Functor key;
+    Hasher hasher;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Functor, class Hasher, class Other>
+auto rusty_iterators::iterator::FilterMaybeIn<T, Functor, Hasher, Other>::next()
+    -> std::optional<T>
+{
+    auto nextItem = it.next();
+
+    while (nextItem.has_value())
+    {
+        if (bloom->mayContain(hasher(std::invoke(key, nextItem.value()))))
+            return std::move(nextItem);
+
+        nextItem = it.next();
+    }
+    return std::nullopt;
+}
+
+template <class T, class Functor, class Hasher, class Other>
+auto rusty_iterators::iterator::FilterMaybeIn<T, Functor, Hasher, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    // Same as filter, it is better to overallocate.
+    return it.sizeHint();
+}
@@ -0,0 +1,380 @@
+#pragma once
+
+#include "concepts.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::containers
+{
+using concepts::HashFunctor;
+
+/*
+ * Insert only hash map with open addressing and linear probing. Entries are
+ * stored inline in the table, next to a separate array of one byte tags
+ * holding seven bits of their hashes. Probing scans the dense tags and
+ * compares the keys only when the tags match, so a lookup usually costs a
+ * single access to the entries.
+ *
+ * Slots are picked by Fibonacci hashing, from the top bits of the hash times
+ * the golden ratio. Every bit of the hash affects them, so the plain
+ * `std::hash` is enough, and dense integer keys, the usual group ids, hardly
+ * ever collide, which keeps the probing branches predictable.
+ *
+ * Iteration order is unspecified, and references to the values are
+ * invalidated by further insertions.
+ */
+template <class K, class V, class Hasher = std::hash<K>, class Equal = std::equal_to<K>>
+    requires HashFunctor<K, Hasher>
+class FlatHashMap
+{
+    template <bool Const>
+    class Iterator;
+
+  public:
+    using value_type     = std::pair<K, V>;
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    explicit FlatHashMap(size_t capacity = 0, Hasher hasher = Hasher{}, Equal equal = Equal{});
+
+    FlatHashMap(const FlatHashMap& other);
+    FlatHashMap(FlatHashMap&& other) noexcept;
+    ~FlatHashMap();
+
+    auto operator=(FlatHashMap other) noexcept -> FlatHashMap&;
+
+    [[nodiscard]] auto begin() -> iterator { return iterator{this, 0}; }
+    [[nodiscard]] auto begin() const -> const_iterator { return const_iterator{this, 0}; }
+    [[nodiscard]] auto end() -> iterator { return iterator{this, tags.size()}; }
+    [[nodiscard]] auto end() const -> const_iterator { return const_iterator{this, tags.size()}; }
+
+    [[nodiscard]] auto contains(const K& key) const -> bool { return find(key) != nullptr; }
+    [[nodiscard]] auto empty() const -> bool { return count == 0; }
+    [[nodiscard]] auto size() const -> size_t { return count; }
+
+    [[nodiscard]] auto find(const K& key) -> V*;
+    [[nodiscard]] auto find(const K& key) const -> const V*;
+
+    // Moves all the entries out, leaving the map empty.
+    [[nodiscard]] auto intoEntries() -> std::vector<value_type>;
+
+    auto operator[](const K& key) -> V& { return tryEmplace(key).first; }
+    auto reserve(size_t capacity) -> void;
+
+    template <class... Args>
+    auto tryEmplace(K key, Args&&... args) -> std::pair<V&, bool>;
+
+  private:
+    // Entries are constructed in place, only in the slots with a tag.
+    union Slot
+    {
+        Slot() {}
+        ~Slot() {}
+
+        value_type entry;
+    };
+
+    // Zero marks an empty slot, tags of the occupied ones have the top bit set.
+    std::vector<uint8_t> tags{};
+    std::vector<Slot> slots{};
+    size_t count = 0;
+    size_t mask  = 0;
+    [[no_unique_address]] Hasher hasher;
+    [[no_unique_address]] Equal equal;
+
+    [[nodiscard]] auto lookup(const K& key, uint64_t hash) const -> size_t;
+    [[nodiscard]] auto placeOf(uint64_t hash) const -> std::pair<size_t, uint8_t>;
+    auto rehash(size_t slotCount) -> void;
+
+    template <class... Args>
+    auto insert(K key, uint64_t hash, size_t idx, Args&&... args) -> V&;
+};
+
+template <class K, class V, class Hasher, class Equal>
+    requires HashFunctor<K, Hasher>
+template <bool Const>
+class FlatHashMap<K, V, Hasher, Equal>::Iterator
+{
+    using Map = std::conditional_t<Const, const FlatHashMap, FlatHashMap>;
+
+  public:
+    using value_type      = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference       = std::conditional_t<Const, const value_type&, value_type&>;
+    using pointer         = std::conditional_t<Const, const value_type*, value_type*>;
+
+    Iterator() = default;
+    Iterator(Map* map, size_t idx) : map(map), idx(idx) { skipEmpty(); }
+
+    [[nodiscard]] auto operator*() const -> reference { return map->slots[idx].entry; }
+    [[nodiscard]] auto operator->() const -> pointer { return &map->slots[idx].entry; }
+    [[nodiscard]] auto operator==(const Iterator& other) const -> bool { return idx == other.idx; }
+
+    auto operator++() -> Iterator&
+    {
+        idx += 1;
+        skipEmpty();
+
+        return *this;
+    }
+
+    auto operator++(int) -> Iterator
+    {
+        auto copy = *this;
+        ++*this;
+
+        return copy;
+    }
+
+  private:
+    Map* map   = nullptr;
+    size_t idx = 0;
+
+    auto skipEmpty() -> void
+    {
+        while (idx < map->tags.size() && map->tags[idx] == 0)
+            idx += 1;
+    }
+};
+} // namespace rusty_iterators::containers
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::FlatHashMap(size_t capacity,
+                                                                          Hasher hasher,
+                                                                          Equal equal)
+    : hasher(std::move(hasher)), equal(std::move(equal))
+{
+    reserve(capacity);
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::FlatHashMap(
+    const FlatHashMap& other)
+    : tags(other.tags), slots(other.tags.size()), count(other.count), mask(other.mask),
+      hasher(other.hasher), equal(other.equal)
+{
+    size_t i = 0;
+
+    try
+    {
+        for (; i < tags.size(); i++)
+        {
+            if (tags[i] != 0)
+                std::construct_at(&slots[i].entry, other.slots[i].entry);
+        }
+    }
+    catch (...)
+    {
+        while (i-- > 0)
+        {
+            if (tags[i] != 0)
+                std::destroy_at(&slots[i].entry);
+        }
+        throw;
+    }
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::FlatHashMap(
+    FlatHashMap&& other) noexcept
+    : tags(std::exchange(other.tags, {})), slots(std::exchange(other.slots, {})),
+      count(std::exchange(other.count, 0)), mask(std::exchange(other.mask, 0)),
+      hasher(std::move(other.hasher)), equal(std::move(other.equal))
+{}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::~FlatHashMap()
+{
+    for (size_t i = 0; i < tags.size(); i++)
+    {
+        if (tags[i] != 0)
+            std::destroy_at(&slots[i].entry);
+    }
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::operator=(
+    FlatHashMap other) noexcept -> FlatHashMap&
+{
+    std::swap(tags, other.tags);
+    std::swap(slots, other.slots);
+    std::swap(count, other.count);
+    std::swap(mask, other.mask);
+    std::swap(hasher, other.hasher);
+    std::swap(equal, other.equal);
+
+    return *this;
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::find(const K& key) -> V*
+{
+    return const_cast<V*>(std::as_const(*this).find(key));
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::find(const K& key) const
+    -> const V*
+{
+    // Maps which were never inserted into have no table at all.
+    [[unlikely]] if (count == 0)
+        return nullptr;
+
+    auto idx = lookup(key, hasher(key));
+    return tags[idx] == 0 ? nullptr : &slots[idx].entry.second;
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::intoEntries()
+    -> std::vector<value_type>
+{
+    auto entries = std::vector<value_type>{};
+    entries.reserve(count);
+
+    for (size_t i = 0; i < tags.size(); i++)
+    {
+        if (tags[i] == 0)
+            continue;
+
+        entries.push_back(std::move(slots[i].entry));
+        std::destroy_at(&slots[i].entry);
+        tags[i] = 0;
+    }
+    count = 0;
+
+    return entries;
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::reserve(size_t capacity)
+    -> void
+{
+    // Tables at most three quarters full keep the linear probes short.
+    auto needed = std::max(std::bit_ceil(capacity + capacity / 3 + 1), size_t{8});
+
+    if (capacity > 0 && needed > tags.size())
+        rehash(needed);
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+template <class... Args>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::tryEmplace(K key,
+                                                                             Args&&... args)
+    -> std::pair<V&, bool>
+{
+    auto hash = static_cast<uint64_t>(hasher(key));
+
+    [[unlikely]] if (tags.empty())
+        return {insert(std::move(key), hash, 0, std::forward<Args>(args)...), true};
+
+    auto idx = lookup(key, hash);
+
+    [[likely]] if (tags[idx] != 0)
+        return {slots[idx].entry.second, false};
+
+    return {insert(std::move(key), hash, idx, std::forward<Args>(args)...), true};
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+template <class... Args>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::insert(K key, uint64_t hash,
+                                                                         size_t idx,
+                                                                         Args&&... args) -> V&
+{
+    // Kept apart from `tryEmplace`, so that the lookups of the keys which are
+    // already there stay small enough to be inlined.
+    [[unlikely]] if (4 * (count + 1) > 3 * tags.size())
+    {
+        rehash(std::max(2 * tags.size(), size_t{8}));
+        idx = lookup(key, hash);
+    }
+
+    std::construct_at(&slots[idx].entry, std::piecewise_construct,
+                      std::forward_as_tuple(std::move(key)),
+                      std::forward_as_tuple(std::forward<Args>(args)...));
+    tags[idx] = placeOf(hash).second;
+    count += 1;
+
+    return slots[idx].entry.second;
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::lookup(const K& key,
+                                                                         uint64_t hash) const
+    -> size_t
+{
+    auto [home, tag] = placeOf(hash);
+
+    for (auto idx = home;; idx = (idx + 1) & mask)
+    {
+        if (tags[idx] == 0)
+            return idx;
+
+        if (tags[idx] == tag && equal(slots[idx].entry.first, key))
+            return idx;
+    }
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::placeOf(uint64_t hash) const
+    -> std::pair<size_t, uint8_t>
+{
+    // Home slot from the top bits of the product, tag from the seven below.
+    constexpr uint64_t golden = 0x9e3779b97f4a7c15;
+
+    auto product = hash * golden;
+    auto shift   = std::countl_zero(mask);
+
+    return {product >> shift, static_cast<uint8_t>(0x80 | ((product >> (shift - 7)) & 0x7f))};
+}
+
+template <class K, class V, class Hasher, class Equal>
+    requires rusty_iterators::concepts::HashFunctor<K, Hasher>
+auto rusty_iterators::containers::FlatHashMap<K, V, Hasher, Equal>::rehash(size_t slotCount)
+    -> void
+{
+    auto oldTags  = std::exchange(tags, std::vector<uint8_t>(slotCount, 0));
+    auto oldSlots = std::exchange(slots, std::vector<Slot>(slotCount));
+    mask          = slotCount - 1;
+
+    for (size_t i = 0; i < oldTags.size(); i++)
+    {
+        if (oldTags[i] == 0)
+            continue;
+
+        // Every key is already unique, so we only look for a free slot. Tags
+        // depend on the table size, so they are placed anew as well.
+        auto& entry     = oldSlots[i].entry;
+        auto [idx, tag] = placeOf(static_cast<uint64_t>(hasher(entry.first)));
+
+        while (tags[idx] != 0)
+            idx = (idx + 1) & mask;
+
+        std::construct_at(&slots[idx].entry, std::move(entry));
+        std::destroy_at(&entry);
+        tags[idx] = tag;
+    }
+}
@@ -0,0 +1,388 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.fwd.hpp"
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace rusty_iterators::iterator
+{
+using concepts::FlatMapFunctor;
+using concepts::FoldFunctor;
+using concepts::ForEachFunctor;
+using concepts::IteratorLike;
+using interface::IterInterface;
+
+template <class Container, bool Copied = false>
+using BorrowedItem = std::conditional_t<
+    !Copied && std::is_lvalue_reference_v<std::ranges::range_reference_t<Container>>,
+    std::reference_wrapper<const std::ranges::range_value_t<Container>>,
+    std::ranges::range_value_t<Container>>;
+
+/*
+ * Iterates in place over a range someone else owns. Same as `LazyIterator`,
+ * ranges of lvalues yield reference wrappers, unless the items are `Copied`
+ * out, because the range won't live as long as them.
+ */
+template <class Container, bool Copied = false>
+    requires std::ranges::input_range<Container>
+class BorrowedRange
+    : public IterInterface<BorrowedItem<Container, Copied>, BorrowedRange<Container, Copied>>
+{
+    using T = BorrowedItem<Container, Copied>;
+
+  public:
+    explicit BorrowedRange(Container& it)
+        : ptr(std::ranges::begin(it)), sentinel(std::ranges::end(it))
+    {}
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, BorrowedItem<Container, Copied>, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::ranges::iterator_t<Container> ptr;
+    [[no_unique_address]] std::ranges::sentinel_t<Container> sentinel;
+};
+
+/*
+ * Iterates over a range returned by value. The range is kept here and its
+ * items are moved out, so it is addressed by position to survive moves of
+ * the iterator itself.
+ */
+template <class Container>
+    requires std::ranges::random_access_range<Container> && std::ranges::sized_range<Container>
+class OwnedRange : public IterInterface<std::ranges::range_value_t<Container>,
+                                        OwnedRange<Container>>
+{
+    using T = std::ranges::range_value_t<Container>;
+
+  public:
+    explicit OwnedRange(Container&& items) : items(std::move(items)) {}
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, std::ranges::range_value_t<Container>, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Container items;
+    size_t position = 0;
+};
+
+/*
+ * Yields copies of the items of an iterator which yields reference wrappers,
+ * for when the items they refer to don't live as long as the copies.
+ */
+template <class Other>
+class CopiedItems : public IterInterface<Unwrapped<typename Other::Type>, CopiedItems<Other>>
+{
+    using T = Unwrapped<typename Other::Type>;
+
+  public:
+    explicit CopiedItems(Other&& it) : it(std::move(it)) {}
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, Unwrapped<typename Other::Type>, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return it.sizeHint(); }
+
+  private:
+    Other it;
+};
+
+// Turns whatever the function of `flatMap` returned into an iterator. Ranges
+// held by reference are borrowed, temporaries are taken over.
+template <bool Copied, class R>
+[[nodiscard]] auto flatSource(R&& inner)
+{
+    using Inner = std::remove_cvref_t<R>;
+
+    if constexpr (IteratorLike<Inner>)
+    {
+        using Item = typename Inner::Type;
+
+        if constexpr (Copied && !std::same_as<Unwrapped<Item>, Item>)
+            return CopiedItems<Inner>{Inner{std::forward<R>(inner)}};
+        else
+            return Inner{std::forward<R>(inner)};
+    }
+    else if constexpr (!std::same_as<std::unwrap_reference_t<Inner>, Inner>)
+        return BorrowedRange<std::remove_reference_t<std::unwrap_reference_t<Inner>>, Copied>{
+            inner.get()};
+    else if constexpr (std::is_lvalue_reference_v<R>)
+        return BorrowedRange<std::remove_reference_t<R>, Copied>{inner};
+    else
+        return OwnedRange<Inner>{std::move(inner)};
+}
+
+// The function of `flatMap` may return a reference, a view or an iterator
+// pointing into the item it was given. Unless that item is a reference
+// itself, it is gone once the inner range is done, so the items of the range
+// are copied out. Only owning containers returned by value are independent.
+template <class Tin, class Functor>
+constexpr bool borrowsItem = [] {
+    using R     = std::invoke_result_t<Functor&, Tin&&>;
+    using Inner = std::remove_cvref_t<R>;
+
+    return std::same_as<std::unwrap_reference_t<Tin>, Tin> &&
+           (std::is_lvalue_reference_v<R> || !std::same_as<std::unwrap_reference_t<Inner>, Inner> ||
+            IteratorLike<Inner> || std::ranges::borrowed_range<Inner> ||
+            std::ranges::view<Inner>);
+}();
+
+template <class Tin, class Functor>
+using FlatSource = decltype(flatSource<borrowsItem<Tin, Functor>>(
+    std::declval<std::invoke_result_t<Functor&, Tin&&>>()));
+
+template <class Tin, class Functor>
+using FlatItem = typename FlatSource<Tin, Functor>::Type;
+
+/*
+ * Maps every item to an iterator or a range and yields their items one after
+ * another. Inner sequences are iterated in place, and `fold` and `forEach`
+ * are forwarded to them, so their own fast paths still apply. When the inner
+ * range may point into the item it came from, the item is kept next to it.
+ */
+template <class Tin, class Functor, class Other>
+    requires FlatMapFunctor<Tin, Functor>
+class FlatMap : public IterInterface<FlatItem<Tin, Functor>, FlatMap<Tin, Functor, Other>>
+{
+    using Inner = FlatSource<Tin, Functor>;
+    using Tout  = FlatItem<Tin, Functor>;
+
+    static constexpr bool borrows = borrowsItem<Tin, Functor>;
+
+  public:
+    explicit FlatMap(Other&& it, Functor&& f)
+        : it(std::forward<Other>(it)), func(std::forward<Functor>(f))
+    {}
+
+    template <class B, class F>
+        requires FoldFunctor<B, FlatItem<Tin, Functor>, F>
+    [[nodiscard]] auto fold(B&& init, F&& f) -> B;
+
+    template <class F>
+        requires ForEachFunctor<FlatItem<Tin, Functor>, F>
+    auto forEach(F&& f) -> void;
+
+    auto next() -> std::optional<Tout>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    Functor func;
+    // On the heap, so the inner range still points to it after moves.
+    [[no_unique_address]] std::conditional_t<borrows, std::unique_ptr<Tin>, std::monostate> outer{};
+    std::optional<Inner> inner = std::nullopt;
+};
+} // namespace rusty_iterators::iterator
+
+template <class Container, bool Copied>
+    requires std::ranges::input_range<Container>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<
+        B, rusty_iterators::iterator::BorrowedItem<Container, Copied>, Functor>
+auto rusty_iterators::iterator::BorrowedRange<Container, Copied>::fold(B&& init, Functor&& f)
+    -> B
+{
+    // Walks the underlying iterators, without the optional returned by `next`.
+    auto func  = std::forward<Functor>(f);
+    auto accum = std::forward<B>(init);
+
+    for (; ptr != sentinel; ++ptr)
+        accum = func(std::move(accum), T{*ptr});
+
+    return std::move(accum);
+}
+
+template <class Container, bool Copied>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::BorrowedRange<Container, Copied>::next() -> std::optional<T>
+{
+    [[unlikely]] if (ptr == sentinel)
+        return std::nullopt;
+
+    auto item = T{*ptr};
+    ++ptr;
+
+    return std::move(item);
+}
+
+template <class Container, bool Copied>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::BorrowedRange<Container, Copied>::sizeHint() const
+    -> std::optional<size_t>
+{
+    if constexpr (std::sized_sentinel_for<std::ranges::sentinel_t<Container>,
+                                          std::ranges::iterator_t<Container>>)
+        return static_cast<size_t>(sentinel - ptr);
+
+    return 0;
+}
+
+template <class Other>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<
+        B, rusty_iterators::iterator::Unwrapped<typename Other::Type>, Functor>
+auto rusty_iterators::iterator::CopiedItems<Other>::fold(B&& init, Functor&& f) -> B
+{
+    auto func = std::forward<Functor>(f);
+
+    return it.fold(std::forward<B>(init),
+                   [&func](auto acc, auto x) { return func(std::move(acc), T{x.get()}); });
+}
+
+template <class Other>
+auto rusty_iterators::iterator::CopiedItems<Other>::next() -> std::optional<T>
+{
+    auto item = it.next();
+
+    [[unlikely]] if (!item.has_value())
+        return std::nullopt;
+
+    return T{item->get()};
+}
+
+template <class Container>
+    requires std::ranges::random_access_range<Container> && std::ranges::sized_range<Container>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<B, std::ranges::range_value_t<Container>,
+                                                    Functor>
+auto rusty_iterators::iterator::OwnedRange<Container>::fold(B&& init, Functor&& f) -> B
+{
+    auto func  = std::forward<Functor>(f);
+    auto accum = std::forward<B>(init);
+    auto first = std::ranges::begin(items);
+    auto size  = std::ranges::size(items);
+
+    for (; position < size; position++)
+        accum = func(std::move(accum), T{std::ranges::iter_move(first + position)});
+
+    return std::move(accum);
+}
+
+template <class Container>
+    requires std::ranges::random_access_range<Container> && std::ranges::sized_range<Container>
+auto rusty_iterators::iterator::OwnedRange<Container>::next() -> std::optional<T>
+{
+    [[unlikely]] if (position == std::ranges::size(items))
+        return std::nullopt;
+
+    return T{std::ranges::iter_move(std::ranges::begin(items) + position++)};
+}
+
+template <class Container>
+    requires std::ranges::random_access_range<Container> && std::ranges::sized_range<Container>
+auto rusty_iterators::iterator::OwnedRange<Container>::sizeHint() const -> std::optional<size_t>
+{
+    return std::ranges::size(items) - position;
+}
+
+template <class Tin, class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapFunctor<Tin, Functor>
+template <class B, class F>
+    requires rusty_iterators::concepts::FoldFunctor<
+        B, rusty_iterators::iterator::FlatItem<Tin, Functor>, F>
+auto rusty_iterators::iterator::FlatMap<Tin, Functor, Other>::fold(B&& init, F&& f) -> B
+{
+    // Inner folds get a reference, so a stateful functor is the same object
+    // for all of them.
+    auto folder = std::forward<F>(f);
+    auto accum  = std::forward<B>(init);
+
+    if (inner.has_value())
+    {
+        accum = inner->fold(std::move(accum), std::ref(folder));
+        inner.reset();
+    }
+
+    return it.fold(std::move(accum), [this, &folder](auto acc, auto x) {
+        return flatSource<borrows>(std::invoke(func, std::move(x)))
+            .fold(std::move(acc), std::ref(folder));
+    });
+}
+
+template <class Tin, class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapFunctor<Tin, Functor>
+template <class F>
+    requires rusty_iterators::concepts::ForEachFunctor<
+        rusty_iterators::iterator::FlatItem<Tin, Functor>, F>
+auto rusty_iterators::iterator::FlatMap<Tin, Functor, Other>::forEach(F&& f) -> void
+{
+    auto consumer = std::forward<F>(f);
+
+    if (inner.has_value())
+    {
+        inner->forEach(std::ref(consumer));
+        inner.reset();
+    }
+
+    it.forEach([this, &consumer](auto x) {
+        flatSource<borrows>(std::invoke(func, std::move(x))).forEach(std::ref(consumer));
+    });
+}
+
+template <class Tin, class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapFunctor<Tin, Functor>
+auto rusty_iterators::iterator::FlatMap<Tin, Functor, Other>::next() -> std::optional<Tout>
+{
+    while (true)
+    {
+        if (inner.has_value())
+        {
+            auto item = inner->next();
+
+            [[likely]] if (item.has_value())
+                return std::move(item);
+        }
+
+        auto nextItem = it.next();
+
+        if (!nextItem.has_value())
+            return std::nullopt;
+
+        if constexpr (borrows)
+        {
+            inner.reset();
+            outer = std::make_unique<Tin>(std::move(nextItem.value()));
+            inner.emplace(flatSource<borrows>(std::invoke(func, std::move(*outer))));
+        }
+        else
+            inner.emplace(flatSource<borrows>(std::invoke(func, std::move(nextItem.value()))));
+    }
+}
+
+template <class Tin, class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapFunctor<Tin, Functor>
+auto rusty_iterators::iterator::FlatMap<Tin, Functor, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    // The remaining inner items are a lower bound, the next inner sequences
+    // may all be empty. Only an infinite input or inner sequence is known to
+    // go on forever.
+    auto size = it.sizeHint();
+
+    if (!size.has_value())
+        return std::nullopt;
+
+    if (!inner.has_value())
+        return 0;
+
+    return inner->sizeHint();
+}
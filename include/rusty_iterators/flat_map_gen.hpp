@@ -0,0 +1,73 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.fwd.hpp"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace rusty_iterators::iterator
+{
+using concepts::FlatMapGenFunctor;
+using interface::IterInterface;
+
+/*
+ * Hands the underlying iterator over to a generator coroutine, which pulls
+ * as many items as it needs and yields zero or more outputs for them. State
+ * kept in the coroutine frame survives between elements, so decoders can be
+ * written as straight line code instead of hand rolled state machines.
+ */
+template <class Functor, class Other>
+    requires FlatMapGenFunctor<Other, Functor>
+class FlatMapGen : public IterInterface<typename std::invoke_result_t<Functor, Other>::Type,
+                                        FlatMapGen<Functor, Other>>
+{
+    using Gen  = std::invoke_result_t<Functor, Other>;
+    using Tout = typename Gen::Type;
+    using Func = std::remove_cvref_t<Functor>;
+
+  public:
+    explicit FlatMapGen(Other&& it, Functor&& f)
+        : it(std::forward<Other>(it)), func(std::make_unique<Func>(std::forward<Functor>(f))),
+          infinite(!this->it->sizeHint().has_value())
+    {}
+
+    auto next() -> std::optional<Tout>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::optional<Other> it;
+    // Lambda coroutines reference their captures through the closure object,
+    // so it must stay at a stable address even if this adapter is moved.
+    std::unique_ptr<Func> func;
+    std::optional<Gen> gen = std::nullopt;
+    bool infinite;
+};
+} // namespace rusty_iterators::iterator
+
+template <class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapGenFunctor<Other, Functor>
+auto rusty_iterators::iterator::FlatMapGen<Functor, Other>::next() -> std::optional<Tout>
+{
+    [[unlikely]] if (!gen.has_value())
+    {
+        gen.emplace(std::invoke(*func, std::move(it.value())));
+        it.reset();
+    }
+    return gen->next();
+}
+
+template <class Functor, class Other>
+    requires rusty_iterators::concepts::FlatMapGenFunctor<Other, Functor>
+auto rusty_iterators::iterator::FlatMapGen<Functor, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    // The coroutine decides how many items it yields, so all we can tell is
+    // whether the input is infinite.
+    if (infinite)
+        return std::nullopt;
+
+    return 0;
+}
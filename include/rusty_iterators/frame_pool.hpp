@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+namespace rusty_iterators::coroutine
+{
+/*
+ * Thread local free lists recycling coroutine frames. Frames are grouped in
+ * size classes, so once a pipeline created a coroutine, creating another one
+ * of a similar size does not touch the global allocator at all.
+ */
+class FramePool
+{
+  public:
+    [[nodiscard]] static auto allocate(size_t size) -> void*;
+    static auto deallocate(void* ptr, size_t size) noexcept -> void;
+
+  private:
+    static constexpr size_t granularity  = 64;
+    static constexpr size_t sizeClasses  = 32;
+    static constexpr size_t maxCachedPer = 64;
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct Cache
+    {
+        std::array<FreeBlock*, sizeClasses> heads{};
+        std::array<size_t, sizeClasses> cached{};
+
+        Cache() = default;
+        ~Cache();
+
+        Cache(const Cache&)                    = delete;
+        auto operator=(const Cache&) -> Cache& = delete;
+        Cache(Cache&&)                         = delete;
+        auto operator=(Cache&&) -> Cache&      = delete;
+    };
+
+    // Frames released during thread teardown, after the cache is gone, are
+    // handed straight back to the global allocator.
+    static inline thread_local bool cacheDestroyed = false;
+
+    [[nodiscard]] static auto cache() -> Cache&;
+    [[nodiscard]] static inline auto sizeClass(size_t size) -> size_t
+    {
+        return (size + granularity - 1) / granularity;
+    }
+};
+} // namespace rusty_iterators::coroutine
+
+inline auto rusty_iterators::coroutine::FramePool::allocate(size_t size) -> void*
+{
+    auto idx = sizeClass(size);
+
+    [[unlikely]] if (idx >= sizeClasses || cacheDestroyed)
+        return ::operator new(size);
+
+    auto& pool = cache();
+    auto* head = pool.heads.at(idx);
+
+    [[unlikely]] if (head == nullptr)
+        return ::operator new(idx * granularity);
+
+    pool.heads.at(idx) = head->next;
+    pool.cached.at(idx) -= 1;
+
+    return head;
+}
+
+inline auto rusty_iterators::coroutine::FramePool::deallocate(void* ptr, size_t size) noexcept
+    -> void
+{
+    auto idx = sizeClass(size);
+
+    [[unlikely]] if (idx >= sizeClasses || cacheDestroyed)
+        return ::operator delete(ptr);
+
+    auto& pool = cache();
+
+    [[unlikely]] if (pool.cached.at(idx) == maxCachedPer)
+        return ::operator delete(ptr);
+
+    pool.heads.at(idx) = new (ptr) FreeBlock{pool.heads.at(idx)};
+    pool.cached.at(idx) += 1;
+}
+
+inline rusty_iterators::coroutine::FramePool::Cache::~Cache()
+{
+    cacheDestroyed = true;
+
+    for (auto* head : heads)
+    {
+        while (head != nullptr)
+        {
+            auto* next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+}
+
+inline auto rusty_iterators::coroutine::FramePool::cache() -> Cache&
+{
+    thread_local Cache pool{};
+    return pool;
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "frame_pool.hpp"
+#include "interface.hpp"
+
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rusty_iterators::iterator
+{
+using coroutine::FramePool;
+using interface::IterInterface;
+
+/*
+ * Coroutine backed source. Any function returning a `Generator<T>` can
+ * `co_yield` values, which are then lazily pulled by the iterator interface.
+ * Frames are allocated from a thread local pool, so creating generators in
+ * a loop does not hit the heap once the pool warms up.
+ */
+template <class T>
+    requires(!std::is_reference_v<T>)
+class Generator : public IterInterface<T, Generator<T>>
+{
+  public:
+    class promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    explicit Generator(Handle handle) : handle(handle) {}
+    ~Generator() override;
+
+    Generator(const Generator&)                    = delete;
+    auto operator=(const Generator&) -> Generator& = delete;
+    Generator(Generator&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    auto operator=(Generator&& other) noexcept -> Generator&;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Handle handle;
+};
+
+template <class T>
+    requires(!std::is_reference_v<T>)
+class Generator<T>::promise_type
+{
+  public:
+    [[nodiscard]] auto get_return_object() -> Generator
+    {
+        return Generator{Handle::from_promise(*this)};
+    }
+
+    [[nodiscard]] auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+    [[nodiscard]] auto final_suspend() noexcept -> std::suspend_always { return {}; }
+
+    template <class U = T>
+        requires std::constructible_from<T, U&&>
+    auto yield_value(U&& value) -> std::suspend_always
+    {
+        current.emplace(std::forward<U>(value));
+        return {};
+    }
+
+    // Generators are synchronous, awaiting inside of them makes no sense.
+    template <class U>
+    auto await_transform(U&& value) -> std::suspend_never = delete;
+
+    auto return_void() -> void {}
+    auto unhandled_exception() -> void { error = std::current_exception(); }
+
+    [[nodiscard]] static auto operator new(size_t size) -> void*
+    {
+        return FramePool::allocate(size);
+    }
+    static auto operator delete(void* ptr, size_t size) noexcept -> void
+    {
+        FramePool::deallocate(ptr, size);
+    }
+
+  private:
+    friend class Generator;
+
+    std::optional<T> current = std::nullopt;
+    std::exception_ptr error = nullptr;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T>
+    requires(!std::is_reference_v<T>)
+rusty_iterators::iterator::Generator<T>::~Generator()
+{
+    if (handle)
+        handle.destroy();
+}
+
+template <class T>
+    requires(!std::is_reference_v<T>)
+auto rusty_iterators::iterator::Generator<T>::operator=(Generator&& other) noexcept -> Generator&
+{
+    if (this != &other)
+    {
+        if (handle)
+            handle.destroy();
+
+        handle = std::exchange(other.handle, {});
+    }
+    return *this;
+}
+
+template <class T>
+    requires(!std::is_reference_v<T>)
+auto rusty_iterators::iterator::Generator<T>::next() -> std::optional<T>
+{
+    [[unlikely]] if (!handle || handle.done())
+        return std::nullopt;
+
+    auto& promise = handle.promise();
+
+    promise.current.reset();
+    handle.resume();
+
+    [[unlikely]] if (handle.done())
+    {
+        if (promise.error)
+            std::rethrow_exception(std::exchange(promise.error, nullptr));
+
+        return std::nullopt;
+    }
+    return std::move(promise.current);
+}
+
+template <class T>
+    requires(!std::is_reference_v<T>)
+auto rusty_iterators::iterator::Generator<T>::sizeHint() const -> std::optional<size_t>
+{
+    // We can't know how many values the coroutine will yield without running it.
+    return 0;
+}
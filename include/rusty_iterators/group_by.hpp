@@ -0,0 +1,142 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "flat_hash_map.hpp"
+#include "interface.fwd.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using concepts::FoldFunctor;
+using concepts::HashFunctor;
+using concepts::Summable;
+using containers::FlatHashMap;
+
+template <class T, class Functor>
+using GroupKey = Unwrapped<std::invoke_result_t<Functor&, T&>>;
+
+/*
+ * Result of `groupBy`, each of the terminals consumes the iterator and
+ * aggregates its items into a `FlatHashMap` from the keys to the results.
+ */
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> && HashFunctor<GroupKey<T, KeyFunctor>, Hasher>
+class GroupBy
+{
+    using K = GroupKey<T, KeyFunctor>;
+
+    template <class V>
+    using Groups = FlatHashMap<K, V, Hasher>;
+
+  public:
+    GroupBy(Other&& it, KeyFunctor&& key, Hasher hasher)
+        : it(std::forward<Other>(it)), key(std::forward<KeyFunctor>(key)),
+          hasher(std::move(hasher))
+    {}
+
+    [[nodiscard]] auto collectGroups() -> Groups<std::vector<T>>;
+    [[nodiscard]] auto counts() -> Groups<size_t>;
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, T, Functor>
+    [[nodiscard]] auto foldBy(B&& init, Functor&& f) -> Groups<B>;
+
+    template <class Functor, class R = Unwrapped<std::invoke_result_t<Functor&, T&>>>
+        requires Summable<R>
+    [[nodiscard]] auto sumBy(Functor&& value) -> Groups<R>;
+
+  private:
+    Other it;
+    KeyFunctor key;
+    Hasher hasher;
+
+    template <class V>
+    [[nodiscard]] auto makeGroups() -> Groups<V>;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, KeyFunctor>, Hasher>
+auto rusty_iterators::iterator::GroupBy<T, KeyFunctor, Other, Hasher>::collectGroups()
+    -> Groups<std::vector<T>>
+{
+    auto groups = makeGroups<std::vector<T>>();
+
+    it.forEach([this, &groups](auto x) {
+        groups.tryEmplace(std::invoke(key, x)).first.push_back(std::move(x));
+    });
+    return groups;
+}
+
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, KeyFunctor>, Hasher>
+auto rusty_iterators::iterator::GroupBy<T, KeyFunctor, Other, Hasher>::counts() -> Groups<size_t>
+{
+    auto groups = makeGroups<size_t>();
+
+    it.forEach([this, &groups](auto x) { groups.tryEmplace(std::invoke(key, x), 0).first += 1; });
+    return groups;
+}
+
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, KeyFunctor>, Hasher>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Functor>
+auto rusty_iterators::iterator::GroupBy<T, KeyFunctor, Other, Hasher>::foldBy(B&& init,
+                                                                            Functor&& f)
+    -> Groups<B>
+{
+    auto groups = makeGroups<B>();
+    auto func   = std::forward<Functor>(f);
+
+    it.forEach([this, &groups, &func, &init](auto x) {
+        auto& accum = groups.tryEmplace(std::invoke(key, x), init).first;
+        accum       = func(std::move(accum), std::move(x));
+    });
+    return groups;
+}
+
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, KeyFunctor>, Hasher>
+template <class Functor, class R>
+    requires rusty_iterators::concepts::Summable<R>
+auto rusty_iterators::iterator::GroupBy<T, KeyFunctor, Other, Hasher>::sumBy(Functor&& value)
+    -> Groups<R>
+{
+    auto groups = makeGroups<R>();
+    auto func   = std::forward<Functor>(value);
+
+    it.forEach([this, &groups, &func](auto x) {
+        auto& accum = groups.tryEmplace(std::invoke(key, x), R{}).first;
+        accum       = accum + static_cast<R>(std::invoke(func, x));
+    });
+    return groups;
+}
+
+template <class T, class KeyFunctor, class Other, class Hasher>
+    requires std::invocable<KeyFunctor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, KeyFunctor>, Hasher>
+template <class V>
+auto rusty_iterators::iterator::GroupBy<T, KeyFunctor, Other, Hasher>::makeGroups() -> Groups<V>
+{
+    // There are never more groups than items, but usually far fewer, so the
+    // size hint only bounds the initial table.
+    static constexpr size_t presizeLimit = 1 << 14;
+
+    auto size = std::min(it.sizeHint().value_or(0), presizeLimit);
+    return Groups<V>{size, hasher};
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace rusty_iterators::hashing
+{
+/*
+ * Finalizer of the SplitMix64 generator. Every input bit affects every output
+ * bit, so it turns weak hashes, like the identity `std::hash` of integers,
+ * into ones which can be split into independent bit ranges.
+ */
+[[nodiscard]] constexpr auto mix(uint64_t x) -> uint64_t
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111eb;
+    x ^= x >> 31;
+
+    return x;
+}
+
+// Default hasher of the probabilistic structures, `std::hash` with good
+// distribution of all the bits.
+template <class T>
+struct Hash
+{
+    [[nodiscard]] auto operator()(const T& value) const -> uint64_t
+    {
+        return mix(std::hash<T>{}(value));
+    }
+};
+} // namespace rusty_iterators::hashing
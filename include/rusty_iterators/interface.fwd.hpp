@@ -1,7 +1,17 @@
 #pragma once
 
+#include <type_traits>
+
 namespace rusty_iterators::interface
 {
 template <class T, class Derived>
 class IterInterface;
 } // namespace rusty_iterators::interface
+
+namespace rusty_iterators::iterator
+{
+// Items of iterators over containers are reference wrappers, while many
+// terminals have to work on (and return) the values themselves.
+template <class T>
+using Unwrapped = std::remove_cvref_t<std::unwrap_reference_t<T>>;
+} // namespace rusty_iterators::iterator
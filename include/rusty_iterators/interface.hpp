@@ -3,59 +3,139 @@
 #include "chain.hpp"
 #include "concepts.hpp"
 #include "cycle.hpp"
+#include "dedup.hpp"
 #include "enumerate.hpp"
 #include "filter.hpp"
 #include "filter_map.hpp"
+#include "filter_maybe_in.hpp"
+#include "flat_map.hpp"
+#include "flat_map_gen.hpp"
+#include "group_by.hpp"
 #include "inspect.hpp"
 #include "interperse.hpp"
+#include "join.hpp"
 #include "map.hpp"
+#include "merge_sorted.hpp"
 #include "moving_window.hpp"
+#include "par_map.hpp"
 #include "peekable.hpp"
+#include "radix.hpp"
+#include "rolling.hpp"
+#include "sample.hpp"
+#include "scan.hpp"
+#include "sketches.hpp"
 #include "skip.hpp"
+#include "sorted_by.hpp"
+#include "spawn.hpp"
+#include "statistics.hpp"
+#include "std_iterator.hpp"
 #include "step_by.hpp"
 #include "take.hpp"
+#include "tee.hpp"
+#include "top_k.hpp"
 #include "zip.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace rusty_iterators::interface
 {
 using concepts::AllFunctor;
 using concepts::AnyFunctor;
+using concepts::ChannelOf;
 using concepts::Comparable;
+using concepts::ContiguousOf;
 using concepts::EqFunctor;
+using concepts::EqualityComparableTo;
+using concepts::Extendable;
 using concepts::FilterFunctor;
 using concepts::FilterMapFunctor;
+using concepts::FlatMapFunctor;
+using concepts::FlatMapGenFunctor;
 using concepts::FoldFunctor;
 using concepts::ForEachFunctor;
+using concepts::HashFunctor;
 using concepts::Indexable;
 using concepts::InspectFunctor;
+using concepts::JoinFunctors;
 using concepts::Multiplyable;
 using concepts::NeFunctor;
+using concepts::Numeric;
 using concepts::PositionFunctor;
+using concepts::RadixKey;
 using concepts::ReduceFunctor;
+using concepts::Subtractable;
 using concepts::Summable;
 using concepts::TryFoldFunctor;
 using concepts::TupleLike;
 
 using iterator::CacheCycle;
 using iterator::Chain;
+using iterator::ChainSegment;
+using iterator::Columns;
+using iterator::Concat;
 using iterator::CopyCycle;
 using iterator::CycleType;
+using iterator::Dedup;
 using iterator::Enumerate;
 using iterator::Filter;
 using iterator::FilterMap;
+using iterator::FilterMaybeIn;
+using iterator::FlatMap;
+using iterator::FlatMapGen;
+using iterator::GroupBy;
+using iterator::GroupKey;
+using iterator::HashJoin;
 using iterator::Inspect;
 using iterator::Interperse;
+using iterator::JoinKey;
+using iterator::JoinType;
 using iterator::Map;
+using iterator::MergeSorted;
 using iterator::MovingWindow;
+using iterator::MultiZip;
+using iterator::ParMap;
 using iterator::Peekable;
+using iterator::PrefixSum;
+using iterator::RollingExtremum;
+using iterator::RollingFold;
+using iterator::RollingMean;
+using iterator::Sample;
+using iterator::Scan;
+using iterator::ScanType;
+using iterator::SemiJoin;
 using iterator::Skip;
+using iterator::SortedBy;
+using iterator::Spawn;
+using iterator::StdIterator;
 using iterator::StepBy;
 using iterator::Take;
+using iterator::Tee;
+using iterator::TeeState;
+using iterator::Unwrapped;
 using iterator::Zip;
+using random::Xoshiro256;
+using statistics::BloomFilter;
+using statistics::HeavyHitter;
+using statistics::Histogram;
+using statistics::HyperLogLog;
+using statistics::SpaceSaving;
+using statistics::Stats;
+using statistics::TDigest;
+using statistics::TopK;
 
 template <class T, class Derived>
 class IterInterface
@@ -81,7 +161,57 @@ class IterInterface
         requires AllFunctor<T, Functor>
     [[nodiscard]] auto all(Functor&& f) -> bool;
 
+    template <class V>
+        requires EqualityComparableTo<T, V>
+    [[nodiscard]] auto allEqual(const V& value) -> bool;
+
+    template <class Build, class BuildKey, class ProbeKey,
+              class Hasher = std::hash<JoinKey<typename Build::Type, BuildKey>>>
+        requires JoinFunctors<T, typename Build::Type, ProbeKey, BuildKey> &&
+                 HashFunctor<JoinKey<typename Build::Type, BuildKey>, Hasher>
+    [[nodiscard]] auto antiJoin(Build&& build, BuildKey&& buildKey, ProbeKey&& probeKey,
+                                Hasher hasher = Hasher{})
+        -> SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                    JoinType::Anti>;
+
+    template <class Hasher = hashing::Hash<Unwrapped<T>>>
+        requires HashFunctor<Unwrapped<T>, Hasher>
+    [[nodiscard]] auto approxDistinct(uint8_t precision = 12, Hasher hasher = Hasher{}) -> size_t;
+
+    [[nodiscard]] auto begin() -> StdIterator<T, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Comparable<R>
+    [[nodiscard]] auto bottomK(size_t k) -> std::vector<T>;
+
     [[nodiscard]] auto collect() -> std::vector<T>;
+
+    template <class Container>
+        requires Extendable<Container, T>
+    [[nodiscard]] auto collect(const typename Container::allocator_type& allocator = {})
+        -> Container;
+
+    template <class Hasher = hashing::Hash<Unwrapped<T>>>
+        requires HashFunctor<Unwrapped<T>, Hasher>
+    [[nodiscard]] auto collectBloom(double bitsPerKey = 10, Hasher hasher = Hasher{})
+        -> BloomFilter;
+
+    template <class Container>
+        requires Extendable<Container, T>
+    auto collectInto(Container& container) -> Container&;
+
+    template <class R>
+        requires std::is_assignable_v<R&, T>
+    auto collectInto(std::span<R> buffer) -> size_t;
+
+    template <class R = T>
+        requires TupleLike<R>
+    [[nodiscard]] auto collectSoA() -> typename Columns<R>::Values;
+
+    template <class V>
+        requires EqualityComparableTo<T, V>
+    [[nodiscard]] auto contains(const V& value) -> bool;
+
     [[nodiscard]] auto count() -> size_t;
 
     template <CycleType type = CycleType::Copy>
@@ -95,6 +225,23 @@ class IterInterface
     template <class Second>
     [[nodiscard]] auto chain(Second&& it) -> Chain<T, Derived, Second>;
 
+    template <class... Others>
+        requires(std::same_as<typename Others::Type, T> && ...)
+    [[nodiscard]] auto chainAll(Others&&... others) -> Concat<T, ChainSegment<Derived, Others...>>;
+
+    template <class R = Unwrapped<T>>
+        requires std::equality_comparable<R>
+    [[nodiscard]] auto dedup() -> Dedup<T, std::identity, Derived>;
+
+    template <class Functor>
+        requires std::invocable<const Functor&, const T&>
+    [[nodiscard]] auto dedupBy(Functor&& key) -> Dedup<T, Functor, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto digest(double compression = 100) -> TDigest;
+
+    [[nodiscard]] auto end() -> std::default_sentinel_t;
     [[nodiscard]] auto enumerate() -> Enumerate<T, Derived>;
 
     template <class Other>
@@ -104,6 +251,10 @@ class IterInterface
         requires EqFunctor<T, Functor>
     [[nodiscard]] auto eqBy(Other&& it, Functor&& f) -> bool;
 
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto exclusivePrefixSum() -> PrefixSum<T, R, Derived, ScanType::Exclusive>;
+
     template <class Functor>
         requires FilterFunctor<T, Functor>
     [[nodiscard]] auto filter(Functor&& f) -> Filter<T, Functor, Derived>;
@@ -113,6 +264,24 @@ class IterInterface
     [[nodiscard]] auto filterMap(Functor&& f)
         -> FilterMap<T, typename std::invoke_result_t<Functor, T>::value_type, Functor, Derived>;
 
+    template <class Functor, class Hasher = hashing::Hash<JoinKey<T, Functor>>>
+        requires std::invocable<Functor&, T&> && HashFunctor<JoinKey<T, Functor>, Hasher>
+    [[nodiscard]] auto filterMaybeIn(const BloomFilter& bloom, Functor&& key,
+                                     Hasher hasher = Hasher{})
+        -> FilterMaybeIn<T, Functor, Hasher, Derived>;
+
+    template <class Functor>
+        requires FlatMapFunctor<T, Functor>
+    [[nodiscard]] auto flatMap(Functor&& f) -> FlatMap<T, Functor, Derived>;
+
+    template <class Functor>
+        requires FlatMapGenFunctor<Derived, Functor>
+    [[nodiscard]] auto flatMapGen(Functor&& f) -> FlatMapGen<Functor, Derived>;
+
+    template <class R = T>
+        requires FlatMapFunctor<R, std::identity>
+    [[nodiscard]] auto flatten() -> FlatMap<R, std::identity, Derived>;
+
     template <class B, class Functor>
         requires FoldFunctor<B, T, Functor>
     [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
@@ -121,6 +290,33 @@ class IterInterface
         requires ForEachFunctor<T, Functor>
     auto forEach(Functor&& f) -> void;
 
+    template <class Functor, class Hasher = std::hash<GroupKey<T, Functor>>>
+        requires std::invocable<Functor&, T&> && HashFunctor<GroupKey<T, Functor>, Hasher>
+    [[nodiscard]] auto groupBy(Functor&& key, Hasher hasher = Hasher{})
+        -> GroupBy<T, Functor, Derived, Hasher>;
+
+    template <class Build, class BuildKey, class ProbeKey,
+              class Hasher = std::hash<JoinKey<typename Build::Type, BuildKey>>>
+        requires JoinFunctors<T, typename Build::Type, ProbeKey, BuildKey> &&
+                 HashFunctor<JoinKey<typename Build::Type, BuildKey>, Hasher>
+    [[nodiscard]] auto hashJoin(Build&& build, BuildKey&& buildKey, ProbeKey&& probeKey,
+                                Hasher hasher = Hasher{})
+        -> HashJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher>;
+
+    template <class Hasher = hashing::Hash<Unwrapped<T>>>
+        requires HashFunctor<Unwrapped<T>, Hasher>
+    [[nodiscard]] auto heavyHitters(size_t k, Hasher hasher = Hasher{})
+        -> std::vector<HeavyHitter<Unwrapped<T>>>;
+
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto histogram(size_t bins, double low, double high) -> Histogram;
+
+    template <class Hasher = hashing::Hash<Unwrapped<T>>>
+        requires HashFunctor<Unwrapped<T>, Hasher>
+    [[nodiscard]] auto hyperLogLog(uint8_t precision = 12, Hasher hasher = Hasher{})
+        -> HyperLogLog;
+
     template <class Functor>
         requires InspectFunctor<T, Functor>
     [[nodiscard]] auto inspect(Functor&& f) -> Inspect<T, Functor, Derived>;
@@ -136,6 +332,17 @@ class IterInterface
         requires Comparable<R>
     [[nodiscard]] auto max() -> std::optional<R>;
 
+    template <class... Others>
+        requires(std::same_as<typename Others::Type, T> && ...) && Comparable<Unwrapped<T>>
+    [[nodiscard]] auto mergeSorted(Others&&... others)
+        -> MergeSorted<T, std::variant<Derived, Others...>, std::identity>;
+
+    template <class Functor, class... Others>
+        requires(std::same_as<typename Others::Type, T> && ...) &&
+                std::invocable<const Functor&, const T&>
+    [[nodiscard]] auto mergeSortedBy(Functor&& key, Others&&... others)
+        -> MergeSorted<T, std::variant<Derived, Others...>, Functor>;
+
     template <class R = T>
         requires Comparable<R>
     [[nodiscard]] auto min() -> std::optional<R>;
@@ -150,28 +357,134 @@ class IterInterface
     [[nodiscard]] auto neBy(Other&& it, Functor&& f) -> bool;
 
     [[nodiscard]] auto nth(size_t element) -> std::optional<T>;
+
+    template <class Functor>
+        requires std::invocable<Functor, T&&>
+    [[nodiscard]] auto parMap(Functor&& f, size_t threads = 0, size_t inFlight = 0)
+        -> ParMap<T, Functor, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto parPrefixSum(ScanType type = ScanType::Inclusive, size_t threads = 0)
+        -> std::vector<R>;
+
+    template <class Functor = std::identity, class R = Unwrapped<T>>
+        requires std::invocable<Functor&, const R&> &&
+                 RadixKey<Unwrapped<std::invoke_result_t<Functor&, const R&>>> &&
+                 std::is_trivially_copyable_v<R> && std::default_initializable<R>
+    [[nodiscard]] auto partitionByRadix(size_t bits, Functor key = Functor{})
+        -> radix::Partitions<R>;
+
     [[nodiscard]] auto peekable() -> Peekable<T, Derived>;
 
     template <class Functor>
         requires PositionFunctor<T, Functor>
     [[nodiscard]] auto position(Functor&& f) -> std::optional<size_t>;
 
+    template <class V>
+        requires EqualityComparableTo<T, V>
+    [[nodiscard]] auto positionOf(const V& value) -> std::optional<size_t>;
+
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto prefixSum() -> PrefixSum<T, R, Derived, ScanType::Inclusive>;
+
     template <class R = T>
         requires Multiplyable<R>
     [[nodiscard]] auto product() -> std::optional<R>;
 
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto quantiles(const std::vector<double>& qs, double compression = 100)
+        -> std::optional<std::vector<double>>;
+
+    template <class Functor>
+        requires std::invocable<Functor&, T&> &&
+                 RadixKey<Unwrapped<std::invoke_result_t<Functor&, T&>>>
+    [[nodiscard]] auto radixSortedBy(Functor&& key) -> std::vector<T>;
+
     template <class Functor>
         requires ReduceFunctor<T, Functor>
     [[nodiscard]] auto reduce(Functor&& f) -> std::optional<T>;
 
+    [[nodiscard]] auto reservoir(size_t k, uint64_t seed = std::random_device{}())
+        -> std::vector<T>;
+
+    template <class B, class Add, class Remove>
+        requires FoldFunctor<B, T, Add> && FoldFunctor<B, T, Remove>
+    [[nodiscard]] auto rollingFold(size_t size, B&& init, Add&& add, Remove&& remove)
+        -> RollingFold<T, B, Add, Remove, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Comparable<R>
+    [[nodiscard]] auto rollingMax(size_t size) -> RollingExtremum<T, std::greater<>, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Summable<R> && Subtractable<R>
+    [[nodiscard]] auto rollingMean(size_t size) -> RollingMean<T, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Comparable<R>
+    [[nodiscard]] auto rollingMin(size_t size) -> RollingExtremum<T, std::less<>, Derived>;
+
+    template <class R = Unwrapped<T>>
+        requires Summable<R> && Subtractable<R>
+    [[nodiscard]] auto rollingSum(size_t size)
+        -> RollingFold<T, R, std::plus<>, std::minus<>, Derived>;
+
+    [[nodiscard]] auto sample(double probability, uint64_t seed = std::random_device{}())
+        -> Sample<T, Derived>;
+
+    template <class B, class Functor>
+        requires FoldFunctor<std::remove_cvref_t<B>, T, Functor>
+    [[nodiscard]] auto scan(B&& init, Functor&& f)
+        -> Scan<T, std::remove_cvref_t<B>, Functor, Derived>;
+
+    template <class Build, class BuildKey, class ProbeKey,
+              class Hasher = std::hash<JoinKey<typename Build::Type, BuildKey>>>
+        requires JoinFunctors<T, typename Build::Type, ProbeKey, BuildKey> &&
+                 HashFunctor<JoinKey<typename Build::Type, BuildKey>, Hasher>
+    [[nodiscard]] auto semiJoin(Build&& build, BuildKey&& buildKey, ProbeKey&& probeKey,
+                                Hasher hasher = Hasher{})
+        -> SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                    JoinType::Semi>;
+
+    template <class Channel>
+        requires ChannelOf<Channel, T>
+    auto sendTo(Channel& channel, size_t batchSize = 64) -> size_t;
+
     [[nodiscard]] auto skip(size_t n) -> Skip<T, Derived>;
+
+    template <class Functor>
+        requires std::invocable<const Functor&, const T&> && std::is_trivially_copyable_v<T>
+    [[nodiscard]] auto sortedBy(
+        Functor&& key, size_t memoryBudget = SortedBy<T, Functor, Derived>::defaultMemoryBudget,
+        std::filesystem::path spillDir = {}) -> SortedBy<T, Functor, Derived>;
+
+    [[nodiscard]] auto spawn(size_t capacity  = 4,
+                             size_t batchSize = Spawn<T, Derived>::defaultBatchSize)
+        -> Spawn<T, Derived>;
     [[nodiscard]] auto stepBy(size_t step) -> StepBy<T, Derived>;
 
+    template <class R = Unwrapped<T>>
+        requires Numeric<R>
+    [[nodiscard]] auto stats() -> Stats;
+
     template <class R = T>
         requires Summable<R>
     [[nodiscard]] auto sum() -> R;
 
     [[nodiscard]] auto take(size_t amount) -> Take<T, Derived>;
+    [[nodiscard]] auto tee(size_t consumers, size_t limit = std::numeric_limits<size_t>::max())
+        -> std::vector<Tee<T, Derived>>;
+
+    template <class R = Unwrapped<T>>
+        requires Comparable<R>
+    [[nodiscard]] auto topK(size_t k) -> std::vector<T>;
+
+    template <class Functor>
+        requires std::invocable<Functor, const T&>
+    [[nodiscard]] auto topKBy(size_t k, Functor&& key) -> std::vector<T>;
 
     template <class B, class Functor>
         requires TryFoldFunctor<B, T, Functor>
@@ -179,8 +492,7 @@ class IterInterface
 
     template <class R = T>
         requires TupleLike<R>
-    [[nodiscard]] auto unzip() -> std::tuple<std::vector<typename std::tuple_element<0, R>::type>,
-                                             std::vector<typename std::tuple_element<1, R>::type>>;
+    [[nodiscard]] auto unzip() -> typename Columns<R>::Items;
 
     template <class R = T>
         requires Indexable<R>
@@ -190,9 +502,16 @@ class IterInterface
     template <class Second>
     [[nodiscard]] auto zip(Second&& it) -> Zip<T, typename Second::Type, Derived, Second>;
 
+    template <class Second, class Third, class... Others>
+    [[nodiscard]] auto zip(Second&& second, Third&& third, Others&&... others)
+        -> MultiZip<Derived, Second, Third, Others...>;
+
   private:
     [[nodiscard]] inline auto self() -> Derived& { return static_cast<Derived&>(*this); }
     auto sizeHintChecked() -> size_t;
+
+    template <class Result>
+    [[nodiscard]] auto collectColumns() -> Result;
 };
 } // namespace rusty_iterators::interface
 
@@ -228,6 +547,62 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::all(Functor&& f) ->
     return self().tryFold(true, std::move(allf));
 }
 
+template <class T, class Derived>
+template <class V>
+    requires rusty_iterators::concepts::EqualityComparableTo<T, V>
+auto rusty_iterators::interface::IterInterface<T, Derived>::allEqual(const V& value) -> bool
+{
+    return self().all([&value](auto x) -> bool { return x == value; });
+}
+
+template <class T, class Derived>
+template <class Build, class BuildKey, class ProbeKey, class Hasher>
+    requires rusty_iterators::concepts::JoinFunctors<T, typename Build::Type, ProbeKey,
+                                                     BuildKey> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::JoinKey<typename Build::Type, BuildKey>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::antiJoin(Build&& build,
+                                                                     BuildKey&& buildKey,
+                                                                     ProbeKey&& probeKey,
+                                                                     Hasher hasher)
+    -> SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                JoinType::Anti>
+{
+    using Join = SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                          JoinType::Anti>;
+
+    return Join{std::forward<Derived>(self()), std::forward<Build>(build),
+                std::forward<BuildKey>(buildKey), std::forward<ProbeKey>(probeKey),
+                std::move(hasher)};
+}
+
+template <class T, class Derived>
+template <class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<
+        rusty_iterators::iterator::Unwrapped<T>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::approxDistinct(uint8_t precision,
+                                                                          Hasher hasher) -> size_t
+{
+    return self().hyperLogLog(precision, std::move(hasher)).estimate();
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::begin() -> StdIterator<T, Derived>
+{
+    return StdIterator<T, Derived>{self()};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Comparable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::bottomK(size_t k) -> std::vector<T>
+{
+    auto smallest = TopK<T, std::identity, std::less<>>{k};
+    self().forEach([&smallest](auto x) { smallest.add(std::move(x)); });
+
+    return smallest.sorted();
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::collect() -> std::vector<T>
 {
@@ -240,6 +615,127 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::collect() -> std::ve
     return std::move(collection);
 }
 
+template <class T, class Derived>
+template <class Container>
+    requires rusty_iterators::concepts::Extendable<Container, T>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collect(
+    const typename Container::allocator_type& allocator) -> Container
+{
+    // The allocator lets `std::pmr` containers draw from a memory resource.
+    auto collection = Container(allocator);
+
+    self().collectInto(collection);
+
+    return collection;
+}
+
+template <class T, class Derived>
+template <class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<
+        rusty_iterators::iterator::Unwrapped<T>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collectBloom(double bitsPerKey,
+                                                                        Hasher hasher)
+    -> BloomFilter
+{
+    // The filter is sized by the exact number of keys, which is only known
+    // after hashing all of them.
+    auto hashes = std::vector<uint64_t>{};
+
+    hashes.reserve(sizeHintChecked());
+    self().forEach([&hashes, &hasher](auto x) { hashes.push_back(hasher(x)); });
+
+    auto bloom = BloomFilter{hashes.size(), bitsPerKey};
+
+    for (auto hash : hashes)
+        bloom.add(hash);
+
+    return bloom;
+}
+
+template <class T, class Derived>
+template <class Container>
+    requires rusty_iterators::concepts::Extendable<Container, T>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collectInto(Container& container)
+    -> Container&
+{
+    auto size = sizeHintChecked();
+
+    // Only grows when the items do not fit, so a cleared container is reused
+    // without allocating, and repeated appends still grow geometrically.
+    if constexpr (requires { container.capacity(); })
+    {
+        auto needed = container.size() + size;
+
+        if (needed > container.capacity())
+            container.reserve(std::max(needed, 2 * container.capacity()));
+    }
+    else if constexpr (requires { container.reserve(size); })
+    {
+        container.reserve(container.size() + size);
+    }
+
+    self().forEach([&container](auto&& x) {
+        // Ordered containers take the end as a hint, sorted items are
+        // inserted in constant time.
+        if constexpr (requires { container.push_back(std::move(x)); })
+            container.push_back(std::move(x));
+        else
+            container.insert(container.end(), std::move(x));
+    });
+    return container;
+}
+
+template <class T, class Derived>
+template <class R>
+    requires std::is_assignable_v<R&, T>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collectInto(std::span<R> buffer)
+    -> size_t
+{
+    // Stops once the buffer is full, the rest of the items stay in the iterator.
+    if constexpr (ContiguousOf<Derived, R>)
+    {
+        auto slice = self().asSlice();
+        slice      = slice.first(std::min(slice.size(), buffer.size()));
+
+        std::ranges::copy(slice, buffer.begin());
+        self().advanceBy(slice.size());
+
+        return slice.size();
+    }
+    else
+    {
+        size_t written = 0;
+
+        while (written < buffer.size())
+        {
+            auto nextItem = self().next();
+
+            [[unlikely]] if (!nextItem.has_value())
+                break;
+
+            buffer[written++] = std::move(nextItem.value());
+        }
+        return written;
+    }
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::TupleLike<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collectSoA() ->
+    typename Columns<R>::Values
+{
+    return collectColumns<typename Columns<R>::Values>();
+}
+
+template <class T, class Derived>
+template <class V>
+    requires rusty_iterators::concepts::EqualityComparableTo<T, V>
+auto rusty_iterators::interface::IterInterface<T, Derived>::contains(const V& value) -> bool
+{
+    return self().positionOf(value).has_value();
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::count() -> size_t
 {
@@ -274,6 +770,70 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::chain(Second&& it)
     return Chain<T, Derived, Second>{std::forward<Derived>(self()), std::forward<Second>(it)};
 }
 
+template <class T, class Derived>
+template <class... Others>
+    requires(std::same_as<typename Others::Type, T> && ...)
+auto rusty_iterators::interface::IterInterface<T, Derived>::chainAll(Others&&... others)
+    -> Concat<T, ChainSegment<Derived, Others...>>
+{
+    using Segment = ChainSegment<Derived, Others...>;
+
+    auto segments = std::vector<Segment>{};
+    segments.reserve(1 + sizeof...(Others));
+
+    if constexpr (std::same_as<Segment, Derived>)
+    {
+        segments.push_back(std::forward<Derived>(self()));
+        (segments.push_back(std::forward<Others>(others)), ...);
+    }
+    else
+    {
+        // Same as `mergeSortedBy`, alternatives are picked by index.
+        segments.emplace_back(std::in_place_index<0>, std::forward<Derived>(self()));
+
+        [&segments, &others...]<size_t... I>(std::index_sequence<I...>) {
+            (segments.emplace_back(std::in_place_index<I + 1>, std::forward<Others>(others)), ...);
+        }(std::index_sequence_for<Others...>{});
+    }
+
+    return Concat<T, Segment>{std::move(segments)};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires std::equality_comparable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::dedup()
+    -> Dedup<T, std::identity, Derived>
+{
+    return Dedup<T, std::identity, Derived>{std::forward<Derived>(self()), std::identity{}};
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<const Functor&, const T&>
+auto rusty_iterators::interface::IterInterface<T, Derived>::dedupBy(Functor&& key)
+    -> Dedup<T, Functor, Derived>
+{
+    return Dedup<T, Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(key)};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::digest(double compression) -> TDigest
+{
+    auto sketch = TDigest{compression};
+    self().forEach([&sketch](auto x) { sketch.add(static_cast<double>(static_cast<R>(x))); });
+
+    return sketch;
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::end() -> std::default_sentinel_t
+{
+    return std::default_sentinel;
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::enumerate() -> Enumerate<T, Derived>
 {
@@ -296,6 +856,15 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::eqBy(Other&& it, Fun
     return self().zip(std::forward<Other>(it)).all(std::forward<Functor>(f));
 }
 
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::exclusivePrefixSum()
+    -> PrefixSum<T, R, Derived, ScanType::Exclusive>
+{
+    return PrefixSum<T, R, Derived, ScanType::Exclusive>{std::forward<Derived>(self())};
+}
+
 template <class T, class Derived>
 template <class Functor>
     requires rusty_iterators::iterator::FilterFunctor<T, Functor>
@@ -316,6 +885,47 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::filterMap(Functor&&
         std::forward<Derived>(self()), std::forward<Functor>(f)};
 }
 
+template <class T, class Derived>
+template <class Functor, class Hasher>
+    requires std::invocable<Functor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::JoinKey<T, Functor>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::filterMaybeIn(const BloomFilter& bloom,
+                                                                         Functor&& key,
+                                                                         Hasher hasher)
+    -> FilterMaybeIn<T, Functor, Hasher, Derived>
+{
+    return FilterMaybeIn<T, Functor, Hasher, Derived>{
+        std::forward<Derived>(self()), bloom, std::forward<Functor>(key), std::move(hasher)};
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires rusty_iterators::concepts::FlatMapFunctor<T, Functor>
+auto rusty_iterators::interface::IterInterface<T, Derived>::flatMap(Functor&& f)
+    -> FlatMap<T, Functor, Derived>
+{
+    return FlatMap<T, Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(f)};
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires rusty_iterators::concepts::FlatMapGenFunctor<Derived, Functor>
+auto rusty_iterators::interface::IterInterface<T, Derived>::flatMapGen(Functor&& f)
+    -> FlatMapGen<Functor, Derived>
+{
+    return FlatMapGen<Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(f)};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::FlatMapFunctor<R, std::identity>
+auto rusty_iterators::interface::IterInterface<T, Derived>::flatten()
+    -> FlatMap<R, std::identity, Derived>
+{
+    return FlatMap<R, std::identity, Derived>{std::forward<Derived>(self()), std::identity{}};
+}
+
 template <class T, class Derived>
 template <class B, class Functor>
     requires rusty_iterators::concepts::FoldFunctor<B, T, Functor>
@@ -352,6 +962,76 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::forEach(Functor&& f)
     }
 }
 
+template <class T, class Derived>
+template <class Functor, class Hasher>
+    requires std::invocable<Functor&, T&> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::GroupKey<T, Functor>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::groupBy(Functor&& key, Hasher hasher)
+    -> GroupBy<T, Functor, Derived, Hasher>
+{
+    return GroupBy<T, Functor, Derived, Hasher>{std::forward<Derived>(self()),
+                                                std::forward<Functor>(key), std::move(hasher)};
+}
+
+template <class T, class Derived>
+template <class Build, class BuildKey, class ProbeKey, class Hasher>
+    requires rusty_iterators::concepts::JoinFunctors<T, typename Build::Type, ProbeKey,
+                                                     BuildKey> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::JoinKey<typename Build::Type, BuildKey>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::hashJoin(Build&& build,
+                                                                     BuildKey&& buildKey,
+                                                                     ProbeKey&& probeKey,
+                                                                     Hasher hasher)
+    -> HashJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher>
+{
+    using Join = HashJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher>;
+
+    return Join{std::forward<Derived>(self()), std::forward<Build>(build),
+                std::forward<BuildKey>(buildKey), std::forward<ProbeKey>(probeKey),
+                std::move(hasher)};
+}
+
+template <class T, class Derived>
+template <class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<
+        rusty_iterators::iterator::Unwrapped<T>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::heavyHitters(size_t k, Hasher hasher)
+    -> std::vector<HeavyHitter<Unwrapped<T>>>
+{
+    auto summary = SpaceSaving<Unwrapped<T>, Hasher>{k, std::move(hasher)};
+    self().forEach([&summary](auto x) { summary.add(x); });
+
+    return summary.top();
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::histogram(size_t bins, double low,
+                                                                     double high) -> Histogram
+{
+    auto result = Histogram{bins, low, high};
+    self().forEach([&result](auto x) { result.add(static_cast<double>(static_cast<R>(x))); });
+
+    return result;
+}
+
+template <class T, class Derived>
+template <class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<
+        rusty_iterators::iterator::Unwrapped<T>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::hyperLogLog(uint8_t precision,
+                                                                       Hasher hasher)
+    -> HyperLogLog
+{
+    auto sketch = HyperLogLog{precision};
+    self().forEach([&sketch, &hasher](const Unwrapped<T>& x) { sketch.add(hasher(x)); });
+
+    return sketch;
+}
+
 template <class T, class Derived>
 template <class Functor>
     requires rusty_iterators::concepts::InspectFunctor<T, Functor>
@@ -391,6 +1071,38 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::max() -> std::option
     return self().reduce([](auto x, auto y) { return std::max(x, y); });
 }
 
+template <class T, class Derived>
+template <class... Others>
+    requires(std::same_as<typename Others::Type, T> && ...) &&
+            rusty_iterators::concepts::Comparable<rusty_iterators::iterator::Unwrapped<T>>
+auto rusty_iterators::interface::IterInterface<T, Derived>::mergeSorted(Others&&... others)
+    -> MergeSorted<T, std::variant<Derived, Others...>, std::identity>
+{
+    return self().mergeSortedBy(std::identity{}, std::forward<Others>(others)...);
+}
+
+template <class T, class Derived>
+template <class Functor, class... Others>
+    requires(std::same_as<typename Others::Type, T> && ...) &&
+            std::invocable<const Functor&, const T&>
+auto rusty_iterators::interface::IterInterface<T, Derived>::mergeSortedBy(Functor&& key,
+                                                                         Others&&... others)
+    -> MergeSorted<T, std::variant<Derived, Others...>, Functor>
+{
+    using Source = std::variant<Derived, Others...>;
+
+    auto sources = std::vector<Source>{};
+    sources.reserve(1 + sizeof...(Others));
+    sources.emplace_back(std::in_place_index<0>, std::forward<Derived>(self()));
+
+    // Alternatives are picked by index, the same type may appear many times.
+    [&sources, &others...]<size_t... I>(std::index_sequence<I...>) {
+        (sources.emplace_back(std::in_place_index<I + 1>, std::forward<Others>(others)), ...);
+    }(std::index_sequence_for<Others...>{});
+
+    return MergeSorted<T, Source, Functor>{std::move(sources), std::forward<Functor>(key)};
+}
+
 template <class T, class Derived>
 template <class R>
     requires rusty_iterators::concepts::Comparable<R>
@@ -429,6 +1141,66 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::nth(size_t n) -> std
     return self().next();
 }
 
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<Functor, T&&>
+auto rusty_iterators::interface::IterInterface<T, Derived>::parMap(Functor&& f, size_t threads,
+                                                                  size_t inFlight)
+    -> ParMap<T, Functor, Derived>
+{
+    return ParMap<T, Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(f),
+                                       threads, inFlight};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::parPrefixSum(ScanType type,
+                                                                        size_t threads)
+    -> std::vector<R>
+{
+    auto result = std::vector<R>(sizeHintChecked());
+
+    // Contiguous sources are summed in place, anything else is collected first.
+    if constexpr (ContiguousOf<Derived, R>)
+    {
+        auto slice = self().asSlice();
+
+        iterator::parallelPrefixSum(slice, std::span<R>{result}, type, threads);
+        self().advanceBy(slice.size());
+    }
+    else
+    {
+        auto items = std::vector<R>{};
+
+        items.reserve(result.size());
+        self().forEach([&items](auto x) { items.push_back(x); });
+        result.resize(items.size());
+
+        iterator::parallelPrefixSum(std::span<const R>{items}, std::span<R>{result}, type,
+                                    threads);
+    }
+    return result;
+}
+
+template <class T, class Derived>
+template <class Functor, class R>
+    requires std::invocable<Functor&, const R&> &&
+             rusty_iterators::concepts::RadixKey<
+                 rusty_iterators::iterator::Unwrapped<std::invoke_result_t<Functor&, const R&>>> &&
+             std::is_trivially_copyable_v<R> && std::default_initializable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::partitionByRadix(size_t bits,
+                                                                            Functor key)
+    -> radix::Partitions<R>
+{
+    auto items = std::vector<R>{};
+
+    items.reserve(sizeHintChecked());
+    self().forEach([&items](auto x) { items.push_back(x); });
+
+    return radix::scatter(std::span<const R>{items}, bits, key);
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::peekable() -> Peekable<T, Derived>
 {
@@ -458,6 +1230,24 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::position(Functor&& f
     return std::nullopt;
 }
 
+template <class T, class Derived>
+template <class V>
+    requires rusty_iterators::concepts::EqualityComparableTo<T, V>
+auto rusty_iterators::interface::IterInterface<T, Derived>::positionOf(const V& value)
+    -> std::optional<size_t>
+{
+    return self().position([&value](auto x) -> bool { return x == value; });
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::prefixSum()
+    -> PrefixSum<T, R, Derived, ScanType::Inclusive>
+{
+    return PrefixSum<T, R, Derived, ScanType::Inclusive>{std::forward<Derived>(self())};
+}
+
 template <class T, class Derived>
 template <class R>
     requires rusty_iterators::concepts::Multiplyable<R>
@@ -466,6 +1256,86 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::product() -> std::op
     return self().reduce([](auto acc, auto x) { return acc * x; });
 }
 
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::quantiles(const std::vector<double>& qs,
+                                                                     double compression)
+    -> std::optional<std::vector<double>>
+{
+    auto sketch = self().digest(compression);
+
+    [[unlikely]] if (sketch.count() == 0)
+        return std::nullopt;
+
+    auto result = std::vector<double>{};
+    result.reserve(qs.size());
+
+    for (auto q : qs)
+        result.push_back(sketch.quantile(q).value());
+
+    return result;
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<Functor&, T&> &&
+             rusty_iterators::concepts::RadixKey<
+                 rusty_iterators::iterator::Unwrapped<std::invoke_result_t<Functor&, T&>>>
+auto rusty_iterators::interface::IterInterface<T, Derived>::radixSortedBy(Functor&& key)
+    -> std::vector<T>
+{
+    using K = Unwrapped<std::invoke_result_t<Functor&, T&>>;
+    using U = radix::Bits<K>;
+
+    auto result = std::vector<T>{};
+    result.reserve(sizeHintChecked());
+
+    // Numbers keyed by their own type are sorted directly, with the key
+    // computed again in every pass. Other small plain items travel with their
+    // keys through every pass, anything else is sorted by index and moved
+    // into place once at the end.
+    if constexpr (RadixKey<T> && std::same_as<K, T>)
+    {
+        self().forEach([&result](auto x) { result.push_back(x); });
+        radix::sortBy(result,
+                      [&key](T x) { return radix::toBits(static_cast<K>(std::invoke(key, x))); });
+    }
+    else if constexpr (std::is_trivially_copyable_v<T> && std::default_initializable<T> &&
+                  sizeof(T) <= 2 * sizeof(size_t))
+    {
+        auto entries = std::vector<radix::Entry<U, T>>{};
+        entries.reserve(result.capacity());
+
+        self().forEach([&entries, &key](auto x) {
+            auto bits = radix::toBits(static_cast<K>(std::invoke(key, x)));
+            entries.push_back({bits, std::move(x)});
+        });
+        radix::sortEntries(entries);
+
+        for (auto& entry : entries)
+            result.push_back(entry.payload);
+    }
+    else
+    {
+        auto items = std::vector<T>{};
+        items.reserve(result.capacity());
+        self().forEach([&items](auto x) { items.push_back(std::move(x)); });
+
+        auto entries = std::vector<radix::Entry<U, size_t>>{};
+        entries.reserve(items.size());
+
+        for (size_t i = 0; i < items.size(); i++)
+            entries.push_back({radix::toBits(static_cast<K>(std::invoke(key, items[i]))), i});
+
+        radix::sortEntries(entries);
+
+        for (const auto& entry : entries)
+            result.push_back(std::move(items[entry.payload]));
+    }
+    return result;
+}
+
 template <class T, class Derived>
 template <class Functor>
     requires rusty_iterators::concepts::ReduceFunctor<T, Functor>
@@ -479,12 +1349,198 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::reduce(Functor&& f)
     return fold(std::move(first.value()), std::forward<Functor>(f));
 }
 
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::reservoir(size_t k, uint64_t seed)
+    -> std::vector<T>
+{
+    sizeHintChecked();
+
+    auto result = std::vector<T>{};
+    result.reserve(k);
+
+    while (result.size() < k)
+    {
+        auto item = self().next();
+
+        [[unlikely]] if (!item.has_value())
+            return result;
+
+        result.push_back(std::move(item.value()));
+    }
+
+    [[unlikely]] if (k == 0)
+        return result;
+
+    // Algorithm L by Li. Instead of drawing a number for every item, we draw
+    // the gap to the next item which replaces one in the reservoir, with the
+    // probability of replacement `w` decreasing as the stream grows.
+    auto rng  = Xoshiro256{seed};
+    auto logW = std::log(rng.unit()) / static_cast<double>(k);
+
+    while (true)
+    {
+        auto item = self().nth(iterator::geometricGap(rng, std::log1p(-std::exp(logW))));
+
+        [[unlikely]] if (!item.has_value())
+            return result;
+
+        result[rng.below(k)] = std::move(item.value());
+        logW += std::log(rng.unit()) / static_cast<double>(k);
+    }
+}
+
+template <class T, class Derived>
+template <class B, class Add, class Remove>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Add> &&
+             rusty_iterators::concepts::FoldFunctor<B, T, Remove>
+auto rusty_iterators::interface::IterInterface<T, Derived>::rollingFold(size_t size, B&& init,
+                                                                       Add&& add, Remove&& remove)
+    -> RollingFold<T, B, Add, Remove, Derived>
+{
+    return RollingFold<T, B, Add, Remove, Derived>{std::forward<Derived>(self()), size,
+                                                   std::forward<B>(init), std::forward<Add>(add),
+                                                   std::forward<Remove>(remove)};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Comparable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::rollingMax(size_t size)
+    -> RollingExtremum<T, std::greater<>, Derived>
+{
+    return RollingExtremum<T, std::greater<>, Derived>{std::forward<Derived>(self()), size};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Summable<R> && rusty_iterators::concepts::Subtractable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::rollingMean(size_t size)
+    -> RollingMean<T, Derived>
+{
+    return RollingMean<T, Derived>{std::forward<Derived>(self()), size};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Comparable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::rollingMin(size_t size)
+    -> RollingExtremum<T, std::less<>, Derived>
+{
+    return RollingExtremum<T, std::less<>, Derived>{std::forward<Derived>(self()), size};
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Summable<R> && rusty_iterators::concepts::Subtractable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::rollingSum(size_t size)
+    -> RollingFold<T, R, std::plus<>, std::minus<>, Derived>
+{
+    return RollingFold<T, R, std::plus<>, std::minus<>, Derived>{
+        std::forward<Derived>(self()), size, R{}, std::plus<>{}, std::minus<>{}};
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::sample(double probability,
+                                                                  uint64_t seed)
+    -> Sample<T, Derived>
+{
+    return Sample<T, Derived>{std::forward<Derived>(self()), probability, seed};
+}
+
+template <class T, class Derived>
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<std::remove_cvref_t<B>, T, Functor>
+auto rusty_iterators::interface::IterInterface<T, Derived>::scan(B&& init, Functor&& f)
+    -> Scan<T, std::remove_cvref_t<B>, Functor, Derived>
+{
+    return Scan<T, std::remove_cvref_t<B>, Functor, Derived>{
+        std::forward<Derived>(self()), std::forward<B>(init), std::forward<Functor>(f)};
+}
+
+template <class T, class Derived>
+template <class Build, class BuildKey, class ProbeKey, class Hasher>
+    requires rusty_iterators::concepts::JoinFunctors<T, typename Build::Type, ProbeKey,
+                                                     BuildKey> &&
+             rusty_iterators::concepts::HashFunctor<
+                 rusty_iterators::iterator::JoinKey<typename Build::Type, BuildKey>, Hasher>
+auto rusty_iterators::interface::IterInterface<T, Derived>::semiJoin(Build&& build,
+                                                                     BuildKey&& buildKey,
+                                                                     ProbeKey&& probeKey,
+                                                                     Hasher hasher)
+    -> SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                JoinType::Semi>
+{
+    using Join = SemiJoin<T, typename Build::Type, Derived, Build, ProbeKey, BuildKey, Hasher,
+                          JoinType::Semi>;
+
+    return Join{std::forward<Derived>(self()), std::forward<Build>(build),
+                std::forward<BuildKey>(buildKey), std::forward<ProbeKey>(probeKey),
+                std::move(hasher)};
+}
+
+template <class T, class Derived>
+template <class Channel>
+    requires rusty_iterators::concepts::ChannelOf<Channel, T>
+auto rusty_iterators::interface::IterInterface<T, Derived>::sendTo(Channel& channel,
+                                                                  size_t batchSize) -> size_t
+{
+    // Items are sent in batches, so the channel synchronizes once per batch.
+    // The channel is not closed afterwards, it can have many senders.
+    auto batch  = std::vector<typename Channel::value_type>{};
+    size_t sent = 0;
+
+    batch.reserve(batchSize);
+
+    auto nextItem = self().next();
+
+    [[likely]] while (nextItem.has_value())
+    {
+        batch.push_back(std::move(nextItem.value()));
+
+        [[unlikely]] if (batch.size() == batchSize)
+        {
+            auto amount = channel.sendBatch(std::span{batch});
+            sent += amount;
+
+            if (amount < batch.size())
+                return sent;
+
+            batch.clear();
+        }
+        nextItem = self().next();
+    }
+
+    if (!batch.empty())
+        sent += channel.sendBatch(std::span{batch});
+
+    return sent;
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::skip(size_t n) -> Skip<T, Derived>
 {
     return Skip<T, Derived>{std::forward<Derived>(self()), n};
 }
 
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<const Functor&, const T&> && std::is_trivially_copyable_v<T>
+auto rusty_iterators::interface::IterInterface<T, Derived>::sortedBy(Functor&& key,
+                                                                    size_t memoryBudget,
+                                                                    std::filesystem::path spillDir)
+    -> SortedBy<T, Functor, Derived>
+{
+    return SortedBy<T, Functor, Derived>{std::forward<Derived>(self()), std::forward<Functor>(key),
+                                         memoryBudget, std::move(spillDir)};
+}
+
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::spawn(size_t capacity, size_t batchSize)
+    -> Spawn<T, Derived>
+{
+    return Spawn<T, Derived>{std::forward<Derived>(self()), capacity, batchSize};
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::stepBy(size_t step)
     -> StepBy<T, Derived>
@@ -492,6 +1548,17 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::stepBy(size_t step)
     return StepBy<T, Derived>{std::forward<Derived>(self()), step};
 }
 
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Numeric<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::stats() -> Stats
+{
+    auto result = Stats{};
+    self().forEach([&result](auto x) { result.add(static_cast<double>(static_cast<R>(x))); });
+
+    return result;
+}
+
 template <class T, class Derived>
 template <class R>
     requires rusty_iterators::concepts::Summable<R>
@@ -506,6 +1573,50 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::take(size_t amount)
     return Take<T, Derived>{std::forward<Derived>(self()), amount};
 }
 
+template <class T, class Derived>
+auto rusty_iterators::interface::IterInterface<T, Derived>::tee(size_t consumers, size_t limit)
+    -> std::vector<Tee<T, Derived>>
+{
+    if (consumers == 0)
+        throw std::length_error{"Tee needs at least one consumer."};
+
+    auto state = std::make_shared<TeeState<T, Derived>>(std::forward<Derived>(self()), consumers,
+                                                        limit);
+    auto result = std::vector<Tee<T, Derived>>{};
+
+    result.reserve(consumers);
+
+    for (size_t i = 0; i < consumers; i++)
+        result.emplace_back(state, i);
+
+    return result;
+}
+
+template <class T, class Derived>
+template <class R>
+    requires rusty_iterators::concepts::Comparable<R>
+auto rusty_iterators::interface::IterInterface<T, Derived>::topK(size_t k) -> std::vector<T>
+{
+    auto largest = TopK<T, std::identity, std::greater<>>{k};
+    self().forEach([&largest](auto x) { largest.add(std::move(x)); });
+
+    return largest.sorted();
+}
+
+template <class T, class Derived>
+template <class Functor>
+    requires std::invocable<Functor, const T&>
+auto rusty_iterators::interface::IterInterface<T, Derived>::topKBy(size_t k, Functor&& key)
+    -> std::vector<T>
+{
+    using Key = std::remove_cvref_t<Functor>;
+
+    auto largest = TopK<T, Key, std::greater<>>{k, std::forward<Functor>(key)};
+    self().forEach([&largest](auto x) { largest.add(std::move(x)); });
+
+    return largest.sorted();
+}
+
 template <class T, class Derived>
 template <class B, class Functor>
     requires rusty_iterators::concepts::TryFoldFunctor<B, T, Functor>
@@ -533,28 +1644,9 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::tryFold(B&& init, Fu
 template <class T, class Derived>
 template <class R>
     requires rusty_iterators::concepts::TupleLike<R>
-auto rusty_iterators::interface::IterInterface<T, Derived>::unzip()
-    -> std::tuple<std::vector<typename std::tuple_element<0, R>::type>,
-                  std::vector<typename std::tuple_element<1, R>::type>>
+auto rusty_iterators::interface::IterInterface<T, Derived>::unzip() -> typename Columns<R>::Items
 {
-    auto size = sizeHintChecked();
-
-    auto first  = std::vector<typename std::tuple_element<0, R>::type>{};
-    auto second = std::vector<typename std::tuple_element<1, R>::type>{};
-
-    first.reserve(size);
-    second.reserve(size);
-
-    auto nextItem = self().next();
-
-    [[likely]] while (nextItem.has_value())
-    {
-        auto [f, s] = nextItem.value();
-        first.push_back(std::move(f));
-        second.push_back(std::move(s));
-        nextItem = self().next();
-    }
-    return std::tuple{std::move(first), std::move(second)};
+    return collectColumns<typename Columns<R>::Items>();
 }
 
 template <class T, class Derived>
@@ -592,6 +1684,17 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::zip(Second&& it)
                                                           std::forward<Second>(it)};
 }
 
+template <class T, class Derived>
+template <class Second, class Third, class... Others>
+auto rusty_iterators::interface::IterInterface<T, Derived>::zip(Second&& second, Third&& third,
+                                                               Others&&... others)
+    -> MultiZip<Derived, Second, Third, Others...>
+{
+    return MultiZip<Derived, Second, Third, Others...>{
+        std::forward<Derived>(self()), std::forward<Second>(second), std::forward<Third>(third),
+        std::forward<Others>(others)...};
+}
+
 template <class T, class Derived>
 auto rusty_iterators::interface::IterInterface<T, Derived>::sizeHintChecked() -> size_t
 {
@@ -603,3 +1706,21 @@ auto rusty_iterators::interface::IterInterface<T, Derived>::sizeHintChecked() ->
     throw std::length_error{
         "Trying to collect an infinite iterator will result in an infinite loop."};
 }
+
+template <class T, class Derived>
+template <class Result>
+auto rusty_iterators::interface::IterInterface<T, Derived>::collectColumns() -> Result
+{
+    // Every field goes straight into its own column, in a single pass.
+    auto size    = sizeHintChecked();
+    auto columns = Result{};
+
+    std::apply([size](auto&... column) { (column.reserve(size), ...); }, columns);
+
+    self().forEach([&columns](auto item) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (std::get<I>(columns).push_back(std::get<I>(std::move(item))), ...);
+        }(std::make_index_sequence<std::tuple_size_v<Result>>{});
+    });
+    return columns;
+}
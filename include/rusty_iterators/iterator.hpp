@@ -3,84 +3,323 @@
 #include "concepts.hpp"
 #include "interface.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
 #include <functional>
+#include <iterator>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
 namespace
 {
+// Ranges returning lvalues are iterated by reference, while ranges producing
+// values on the fly (like `std::views::iota` or `std::views::transform`)
+// hand those values out directly.
 template <class Container>
-    requires std::ranges::range<Container>
-using Item = std::reference_wrapper<const typename Container::value_type>;
+    requires std::ranges::input_range<Container>
+using Item = std::conditional_t<
+    std::is_lvalue_reference_v<std::ranges::range_reference_t<Container>>,
+    std::reference_wrapper<const std::ranges::range_value_t<Container>>,
+    std::ranges::range_value_t<Container>>;
 } // namespace
 
 namespace rusty_iterators::iterator
 {
+using concepts::ByteLike;
+using concepts::ContiguousOf;
 using concepts::FoldFunctor;
 using concepts::Multiplyable;
 using concepts::Summable;
+using concepts::TriviallyComparable;
 
 template <class Container>
-    requires std::ranges::range<Container>
+    requires std::ranges::input_range<Container>
 class LazyIterator : public interface::IterInterface<Item<Container>, LazyIterator<Container>>
 {
-    using RawT     = typename Container::value_type;
+    using RawT     = std::ranges::range_value_t<Container>;
     using T        = Item<Container>;
-    using Iterator = typename Container::iterator;
+    using Iterator = std::ranges::iterator_t<Container>;
+    using Sentinel = std::ranges::sentinel_t<Container>;
+    using Base     = interface::IterInterface<T, LazyIterator<Container>>;
+
+    // Sized ranges without random access (`std::list`, `std::map`) know their
+    // size only upfront, so we keep track of the remaining elements.
+    static constexpr bool isSized    = std::sized_sentinel_for<Sentinel, Iterator>;
+    static constexpr bool tracksSize = !isSized && std::ranges::sized_range<Container>;
+
+    // Contiguous storage of trivially comparable values can be searched and
+    // compared with `memchr`/`memcmp` instead of going element by element.
+    static constexpr bool isContiguous = std::ranges::contiguous_range<Container> && isSized;
+    static constexpr bool isFlat       = isContiguous && TriviallyComparable<RawT>;
 
   public:
-    explicit LazyIterator(Container& it) : ptr(it.begin()), end(it.end()) {}
+    // The size hint is the exact number of remaining items.
+    static constexpr bool exactSize = isSized || tracksSize;
+
+    explicit LazyIterator(Container& it)
+        : ptr(std::ranges::begin(it)), sentinel(std::ranges::end(it))
+    {
+        if constexpr (tracksSize)
+            remaining = std::ranges::size(it);
+    }
+
+    // Borrowed ranges (`std::span`, `std::string_view`, `std::views::iota`)
+    // can be passed as temporaries, because their iterators don't dangle.
+    explicit LazyIterator(Container&& it)
+        requires std::ranges::borrowed_range<Container>
+        : LazyIterator(it)
+    {}
+
+    auto advanceBy(size_t amount) -> void;
+
+    [[nodiscard]] auto allEqual(const RawT& value) -> bool;
+
+    [[nodiscard]] auto asSlice() const -> std::span<const RawT>
+        requires isContiguous;
+
+    [[nodiscard]] auto contains(const RawT& value) -> bool;
+
+    template <class Other>
+    [[nodiscard]] auto eq(Other&& it) -> bool;
+
+    template <class Other>
+    [[nodiscard]] auto ne(Other&& it) -> bool;
 
     auto next() -> std::optional<T>;
-    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+    [[nodiscard]] auto positionOf(const RawT& value) -> std::optional<size_t>;
 
     template <class R = RawT>
         requires Multiplyable<R>
     [[nodiscard]] auto product() -> std::optional<R>;
 
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
     template <class R = RawT>
         requires Summable<R>
     [[nodiscard]] auto sum() -> R;
 
   private:
     Iterator ptr;
-    Iterator end;
+    [[no_unique_address]] Sentinel sentinel;
+    size_t remaining = 0;
+
+    [[nodiscard]] auto consumeUntil(std::optional<size_t> idx) -> std::optional<size_t>;
+
+    [[nodiscard]] static inline auto unwrap(const T& item) -> const RawT& { return item; }
 };
 } // namespace rusty_iterators::iterator
 
 template <class Container>
-    requires std::ranges::range<Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::advanceBy(size_t amount) -> void
+{
+    // Random access ranges jump straight to the target, everything else is
+    // bounded by the sentinel, so we never walk past the end.
+    auto distance = static_cast<std::iter_difference_t<Iterator>>(amount);
+
+    if constexpr (std::random_access_iterator<Iterator> &&
+                  std::same_as<Sentinel, std::unreachable_sentinel_t>)
+    {
+        ptr += distance;
+        return;
+    }
+    auto missing = std::ranges::advance(ptr, distance, sentinel);
+
+    if constexpr (tracksSize)
+        remaining -= static_cast<size_t>(distance - missing);
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::allEqual(const RawT& value) -> bool
+{
+    if constexpr (isFlat)
+    {
+        // Comparing against a value has no side effects, so whole blocks are
+        // checked without an early exit and vectorize. Only the block holding
+        // the first mismatch is scanned item by item.
+        constexpr size_t blockSize = 64;
+
+        auto slice = asSlice();
+        size_t idx = 0;
+
+        for (; idx + blockSize <= slice.size(); idx += blockSize)
+        {
+            bool equal = true;
+
+            for (const auto& item : slice.subspan(idx, blockSize))
+                equal &= item == value;
+
+            [[unlikely]] if (!equal)
+                break;
+        }
+        for (; idx < slice.size(); idx++)
+        {
+            [[unlikely]] if (slice[idx] != value)
+                return !consumeUntil(idx).has_value();
+        }
+        return !consumeUntil(std::nullopt).has_value();
+    }
+    else
+        return Base::all([&value](const T& x) -> bool { return unwrap(x) == value; });
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::asSlice() const -> std::span<const RawT>
+    requires isContiguous
+{
+    return std::span<const RawT>{ptr, sentinel};
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::contains(const RawT& value) -> bool
+{
+    return positionOf(value).has_value();
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+template <class Other>
+auto rusty_iterators::iterator::LazyIterator<Container>::eq(Other&& it) -> bool
+{
+    if constexpr (isFlat && ContiguousOf<std::remove_cvref_t<Other>, RawT>)
+    {
+        // Zip based comparison stops at the shorter iterator, so the common
+        // prefix is all we have to compare to keep the same semantics.
+        auto lhs  = asSlice();
+        auto rhs  = it.asSlice();
+        auto size = std::min(lhs.size(), rhs.size());
+
+        // Empty spans may hold a null data pointer, which `memcmp` must never
+        // receive, even for a zero length.
+        [[unlikely]] if (size == 0)
+            return true;
+
+        ptr += size;
+        return std::memcmp(lhs.data(), rhs.data(), size * sizeof(RawT)) == 0;
+    }
+    else
+        return Base::eq(std::forward<Other>(it));
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+template <class Other>
+auto rusty_iterators::iterator::LazyIterator<Container>::ne(Other&& it) -> bool
+{
+    if constexpr (isFlat && ContiguousOf<std::remove_cvref_t<Other>, RawT>)
+        return !eq(std::forward<Other>(it));
+    else
+        return Base::ne(std::forward<Other>(it));
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
 auto rusty_iterators::iterator::LazyIterator<Container>::next() -> std::optional<T>
 {
-    [[unlikely]] if (ptr == end)
+    [[unlikely]] if (ptr == sentinel)
         return std::nullopt;
 
-    auto& item = *ptr;
-    ptr += 1;
+    if constexpr (tracksSize)
+        remaining -= 1;
 
-    return std::cref(item);
+    if constexpr (std::is_lvalue_reference_v<std::iter_reference_t<Iterator>>)
+    {
+        auto& item = *ptr;
+        ++ptr;
+        return std::cref(item);
+    }
+    else
+    {
+        auto item = *ptr;
+        ++ptr;
+        return std::move(item);
+    }
 }
 
 template <class Container>
-    requires std::ranges::range<Container>
-auto rusty_iterators::iterator::LazyIterator<Container>::sizeHint() const -> std::optional<size_t>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::positionOf(const RawT& value)
+    -> std::optional<size_t>
 {
-    return end - ptr;
+    if constexpr (isFlat)
+    {
+        auto slice = asSlice();
+        auto idx   = std::optional<size_t>{};
+
+        if constexpr (ByteLike<RawT>)
+        {
+            auto needle = static_cast<int>(std::bit_cast<unsigned char>(value));
+            auto* found = std::memchr(slice.data(), needle, slice.size());
+
+            if (found != nullptr)
+                idx = static_cast<const RawT*>(found) - slice.data();
+        }
+        else
+        {
+            auto found = std::ranges::find(slice, value);
+
+            if (found != slice.end())
+                idx = found - slice.begin();
+        }
+        return consumeUntil(idx);
+    }
+    else
+        return Base::position([&value](const T& x) -> bool { return unwrap(x) == value; });
 }
 
 template <class Container>
-    requires std::ranges::range<Container>
+    requires std::ranges::input_range<Container>
 template <class R>
     requires rusty_iterators::concepts::Multiplyable<R>
 auto rusty_iterators::iterator::LazyIterator<Container>::product() -> std::optional<R>
 {
-    return this->map([](auto x) { return x.get(); }).product();
+    return this->map([](auto x) -> RawT { return unwrap(x); }).product();
 }
 
 template <class Container>
-    requires std::ranges::range<Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::sizeHint() const -> std::optional<size_t>
+{
+    if constexpr (isSized)
+        return static_cast<size_t>(sentinel - ptr);
+    else if constexpr (tracksSize)
+        return remaining;
+    else if constexpr (std::same_as<Sentinel, std::unreachable_sentinel_t>)
+        return std::nullopt;
+    else
+        // Same as for lazy file reading, we can't know the size of a generic
+        // input range without consuming it.
+        return 0;
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
 template <class R>
     requires rusty_iterators::concepts::Summable<R>
 auto rusty_iterators::iterator::LazyIterator<Container>::sum() -> R
 {
-    return this->map([](auto x) { return x.get(); }).sum();
+    return this->map([](auto x) -> RawT { return unwrap(x); }).sum();
+}
+
+template <class Container>
+    requires std::ranges::input_range<Container>
+auto rusty_iterators::iterator::LazyIterator<Container>::consumeUntil(std::optional<size_t> idx)
+    -> std::optional<size_t>
+{
+    // Mirror the element by element implementation, which consumes the
+    // iterator up to and including the found element.
+    [[likely]] if (idx.has_value())
+        ptr += idx.value() + 1;
+    else
+        ptr = std::ranges::next(ptr, sentinel);
+
+    return idx;
 }
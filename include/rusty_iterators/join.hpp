@@ -0,0 +1,288 @@
+#pragma once
+
+#include "flat_hash_map.hpp"
+#include "interface.fwd.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using containers::FlatHashMap;
+using interface::IterInterface;
+
+enum class JoinType : uint8_t
+{
+    Anti,
+    Semi,
+};
+
+template <class B, class Functor>
+using JoinKey = Unwrapped<std::invoke_result_t<Functor&, B&>>;
+
+/*
+ * The items of one side of a join, grouped by key. The items of a key are
+ * stored contiguously and keep their order, the table maps every key to the
+ * `[first, last)` range of its items.
+ */
+template <class Item, class Key, class Hasher>
+class JoinTable
+{
+  public:
+    explicit JoinTable(Hasher hasher) : groups(0, std::move(hasher)) {}
+
+    template <class Other, class Functor>
+    auto build(Other& it, Functor& key) -> void;
+
+    [[nodiscard]] auto find(const Key& key) const -> const std::pair<size_t, size_t>*
+    {
+        return groups.find(key);
+    }
+    [[nodiscard]] auto row(size_t idx) const -> const Item& { return rows[idx]; }
+
+  private:
+    FlatHashMap<Key, std::pair<size_t, size_t>, Hasher> groups;
+    std::vector<Item> rows{};
+};
+
+/*
+ * Inner equi-join of two iterators. One side is consumed into a hash table
+ * on the first call to `next`, the other one is streamed and every one of
+ * its items is paired with all the table items of the same key, in the
+ * order they were consumed.
+ *
+ * The table is built from the build side, unless both size hints are known
+ * and the probe side is smaller. The pairs are then ordered by the build
+ * side instead of the probe side, but their elements keep their positions.
+ */
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher>
+class HashJoin
+    : public IterInterface<std::tuple<T, B>,
+                           HashJoin<T, B, Other, Build, ProbeKey, BuildKey, Hasher>>
+{
+  public:
+    explicit HashJoin(Other&& it, Build&& build, BuildKey&& buildKey, ProbeKey&& probeKey,
+                      Hasher hasher)
+        : it(std::forward<Other>(it)), build(std::forward<Build>(build)),
+          buildKey(std::forward<BuildKey>(buildKey)), probeKey(std::forward<ProbeKey>(probeKey)),
+          buildRows(hasher), probeRows(std::move(hasher))
+    {}
+
+    auto next() -> std::optional<std::tuple<T, B>>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    using Key = JoinKey<B, BuildKey>;
+
+    Other it;
+    Build build;
+    BuildKey buildKey;
+    ProbeKey probeKey;
+
+    // Only the table of the consumed side is filled.
+    JoinTable<B, Key, Hasher> buildRows;
+    JoinTable<T, Key, Hasher> probeRows;
+
+    std::optional<T> probeItem = std::nullopt;
+    std::optional<B> buildItem = std::nullopt;
+    size_t cursor              = 0;
+    size_t last                = 0;
+    bool built                 = false;
+    bool swapped               = false;
+
+    auto buildTable() -> void;
+};
+
+/*
+ * Keeps the items of the probe side which have (semi-join) or don't have
+ * (anti-join) a build item of the same key. Only the keys of the build side
+ * are stored.
+ */
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher,
+          JoinType type>
+class SemiJoin
+    : public IterInterface<T, SemiJoin<T, B, Other, Build, ProbeKey, BuildKey, Hasher, type>>
+{
+  public:
+    explicit SemiJoin(Other&& it, Build&& build, BuildKey&& buildKey, ProbeKey&& probeKey,
+                      Hasher hasher)
+        : it(std::forward<Other>(it)), build(std::forward<Build>(build)),
+          buildKey(std::forward<BuildKey>(buildKey)), probeKey(std::forward<ProbeKey>(probeKey)),
+          keys(0, std::move(hasher))
+    {}
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    Build build;
+    BuildKey buildKey;
+    ProbeKey probeKey;
+    FlatHashMap<JoinKey<B, BuildKey>, std::monostate, Hasher> keys;
+    bool built = false;
+};
+} // namespace rusty_iterators::iterator
+
+template <class Item, class Key, class Hasher>
+template <class Other, class Functor>
+auto rusty_iterators::iterator::JoinTable<Item, Key, Hasher>::build(Other& it, Functor& key) -> void
+{
+    auto size  = it.sizeHint().value_or(0);
+    auto items = std::vector<Item>{};
+    auto ids   = std::vector<size_t>{};
+
+    groups.reserve(size);
+    items.reserve(size);
+    ids.reserve(size);
+
+    // Every key gets an id in the order it was first seen, and counts its
+    // items. Remembering the id of every item lets the items be grouped by
+    // a counting sort, without hashing their keys a second time.
+    it.forEach([this, &key, &items, &ids](auto x) {
+        auto nextId = groups.size();
+        auto& group = groups.tryEmplace(std::invoke(key, x), nextId, 0).first;
+
+        group.second += 1;
+        ids.push_back(group.first);
+        items.push_back(std::move(x));
+    });
+
+    auto starts  = std::vector<size_t>(groups.size());
+    size_t total = 0;
+
+    for (auto& [k, range] : groups)
+    {
+        starts[range.first] = total;
+        range               = {total, total + range.second};
+        total               = range.second;
+    }
+
+    auto order = std::vector<size_t>(items.size());
+
+    for (size_t i = 0; i < items.size(); i++)
+        order[starts[ids[i]]++] = i;
+
+    rows.reserve(items.size());
+
+    for (auto idx : order)
+        rows.push_back(std::move(items[idx]));
+}
+
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher>
+auto rusty_iterators::iterator::HashJoin<T, B, Other, Build, ProbeKey, BuildKey, Hasher>::next()
+    -> std::optional<std::tuple<T, B>>
+{
+    [[unlikely]] if (!built)
+    {
+        buildTable();
+        built = true;
+    }
+
+    while (cursor == last)
+    {
+        const std::pair<size_t, size_t>* group = nullptr;
+
+        if (swapped)
+        {
+            auto nextItem = build.next();
+
+            if (!nextItem.has_value())
+                return std::nullopt;
+
+            group     = probeRows.find(std::invoke(buildKey, nextItem.value()));
+            buildItem = std::move(nextItem);
+        }
+        else
+        {
+            auto nextItem = it.next();
+
+            if (!nextItem.has_value())
+                return std::nullopt;
+
+            group     = buildRows.find(std::invoke(probeKey, nextItem.value()));
+            probeItem = std::move(nextItem);
+        }
+
+        if (group == nullptr)
+            continue;
+
+        cursor = group->first;
+        last   = group->second;
+    }
+
+    if (swapped)
+        return std::tuple<T, B>{probeRows.row(cursor++), buildItem.value()};
+
+    return std::tuple<T, B>{probeItem.value(), buildRows.row(cursor++)};
+}
+
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher>
+auto rusty_iterators::iterator::HashJoin<T, B, Other, Build, ProbeKey, BuildKey,
+                                         Hasher>::sizeHint() const -> std::optional<size_t>
+{
+    // Every streamed item can have any number of matches, so only an
+    // infinite probe side is known upfront.
+    auto size = it.sizeHint();
+
+    if (!size.has_value())
+        return std::nullopt;
+
+    return 0;
+}
+
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher>
+auto rusty_iterators::iterator::HashJoin<T, B, Other, Build, ProbeKey, BuildKey,
+                                         Hasher>::buildTable() -> void
+{
+    // A zero hint means an unknown size for most iterators, so the sides are
+    // only swapped when both sizes are known.
+    auto probeSize = it.sizeHint().value_or(0);
+    auto buildSize = build.sizeHint().value_or(0);
+
+    swapped = probeSize != 0 && probeSize < buildSize;
+
+    if (swapped)
+        probeRows.build(it, probeKey);
+    else
+        buildRows.build(build, buildKey);
+}
+
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher,
+          rusty_iterators::iterator::JoinType type>
+auto rusty_iterators::iterator::SemiJoin<T, B, Other, Build, ProbeKey, BuildKey, Hasher,
+                                         type>::next() -> std::optional<T>
+{
+    [[unlikely]] if (!built)
+    {
+        keys.reserve(build.sizeHint().value_or(0));
+        build.forEach([this](auto x) { keys.tryEmplace(std::invoke(buildKey, x)); });
+        built = true;
+    }
+
+    auto nextItem = it.next();
+
+    while (nextItem.has_value())
+    {
+        if (keys.contains(std::invoke(probeKey, nextItem.value())) == (type == JoinType::Semi))
+            return std::move(nextItem);
+
+        nextItem = it.next();
+    }
+    return std::nullopt;
+}
+
+template <class T, class B, class Other, class Build, class ProbeKey, class BuildKey, class Hasher,
+          rusty_iterators::iterator::JoinType type>
+auto rusty_iterators::iterator::SemiJoin<T, B, Other, Build, ProbeKey, BuildKey, Hasher,
+                                         type>::sizeHint() const -> std::optional<size_t>
+{
+    // Same as filter, it is better to overallocate.
+    return it.sizeHint();
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+
+/*
+ * Merges iterators sorted in ascending order of their keys into one sorted
+ * iterator. The current items of the inputs play a tournament in a loser
+ * tree, whose inner nodes remember the loser of every match, so replacing
+ * the winner replays only its path to the root, `log k` comparisons per
+ * item without any swaps of the items themselves.
+ *
+ * Equal keys come out in the order of the inputs, so merging is stable.
+ * Sources of different types are held in a `std::variant`.
+ */
+template <class T, class Source, class Key>
+class MergeSorted : public IterInterface<T, MergeSorted<T, Source, Key>>
+{
+  public:
+    explicit MergeSorted(std::vector<Source>&& sources, Key&& key)
+        : sources(std::move(sources)), key(std::forward<Key>(key))
+    {}
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::vector<Source> sources;
+    Key key;
+    std::vector<std::optional<T>> heads{};
+    // Node `0` holds the overall winner, the leaf of source `i` is `k + i`.
+    std::vector<size_t> tree{};
+    bool started = false;
+
+    [[nodiscard]] auto beats(size_t first, size_t second) const -> bool;
+    auto start() -> void;
+    auto replay(size_t source) -> void;
+
+    template <class Other>
+    [[nodiscard]] static auto pull(Other& it) -> std::optional<T>;
+    template <class... Others>
+    [[nodiscard]] static auto pull(std::variant<Others...>& it) -> std::optional<T>;
+
+    template <class Other>
+    [[nodiscard]] static auto hint(const Other& it) -> std::optional<size_t>;
+    template <class... Others>
+    [[nodiscard]] static auto hint(const std::variant<Others...>& it) -> std::optional<size_t>;
+};
+
+// Merges a runtime number of sorted iterators of the same type.
+template <class Other>
+[[nodiscard]] auto mergeSorted(std::vector<Other> its)
+    -> MergeSorted<typename Other::Type, Other, std::identity>
+{
+    return MergeSorted<typename Other::Type, Other, std::identity>{std::move(its),
+                                                                   std::identity{}};
+}
+
+template <class Functor, class Other>
+[[nodiscard]] auto mergeSortedBy(Functor&& key, std::vector<Other> its)
+    -> MergeSorted<typename Other::Type, Other, Functor>
+{
+    return MergeSorted<typename Other::Type, Other, Functor>{std::move(its),
+                                                             std::forward<Functor>(key)};
+}
+} // namespace rusty_iterators::iterator
+
+template <class T, class Source, class Key>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::next() -> std::optional<T>
+{
+    [[unlikely]] if (!started)
+    {
+        start();
+        started = true;
+    }
+
+    if (sources.empty())
+        return std::nullopt;
+
+    auto winner = tree[0];
+
+    // Exhausted sources lose every match, so it's the end if even the winner
+    // has nothing left.
+    if (!heads[winner].has_value())
+        return std::nullopt;
+
+    auto item     = std::move(heads[winner]);
+    heads[winner] = pull(sources[winner]);
+    replay(winner);
+
+    return item;
+}
+
+template <class T, class Source, class Key>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::sizeHint() const
+    -> std::optional<size_t>
+{
+    size_t size = 0;
+
+    for (const auto& head : heads)
+        size += head.has_value();
+
+    for (const auto& source : sources)
+    {
+        auto sourceSize = hint(source);
+
+        if (!sourceSize.has_value())
+            return std::nullopt;
+
+        size += sourceSize.value();
+    }
+    return size;
+}
+
+template <class T, class Source, class Key>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::beats(size_t first,
+                                                                  size_t second) const -> bool
+{
+    using K = std::remove_cvref_t<
+        std::unwrap_reference_t<std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>>>;
+
+    if (!heads[second].has_value())
+        return true;
+
+    if (!heads[first].has_value())
+        return false;
+
+    // Keys of the iterators over containers are reference wrappers, which
+    // don't forward the comparison operators.
+    const auto& a = std::invoke(key, heads[first].value());
+    const auto& b = std::invoke(key, heads[second].value());
+
+    // Ties go to the earlier source, so a single comparison is enough.
+    if (first < second)
+        return !(static_cast<const K&>(b) < static_cast<const K&>(a));
+
+    return static_cast<const K&>(a) < static_cast<const K&>(b);
+}
+
+template <class T, class Source, class Key>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::start() -> void
+{
+    auto k = sources.size();
+
+    heads.reserve(k);
+
+    for (auto& source : sources)
+        heads.push_back(pull(source));
+
+    if (k == 0)
+        return;
+
+    // Winners of the matches are only needed while building the tree, later
+    // the single path of the previous winner is replayed against the losers.
+    auto winners = std::vector<size_t>(2 * k);
+    tree.assign(k, 0);
+
+    for (size_t i = 0; i < k; i++)
+        winners[k + i] = i;
+
+    for (auto node = k - 1; node > 0; node--)
+    {
+        auto left  = winners[2 * node];
+        auto right = winners[2 * node + 1];
+        auto won   = beats(left, right);
+
+        winners[node] = won ? left : right;
+        tree[node]    = won ? right : left;
+    }
+    tree[0] = winners[1];
+}
+
+template <class T, class Source, class Key>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::replay(size_t source) -> void
+{
+    auto winner = source;
+
+    for (auto node = (source + sources.size()) / 2; node > 0; node /= 2)
+    {
+        if (beats(tree[node], winner))
+            std::swap(tree[node], winner);
+    }
+    tree[0] = winner;
+}
+
+template <class T, class Source, class Key>
+template <class Other>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::pull(Other& it) -> std::optional<T>
+{
+    return it.next();
+}
+
+template <class T, class Source, class Key>
+template <class... Others>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::pull(std::variant<Others...>& it)
+    -> std::optional<T>
+{
+    return std::visit([](auto& source) -> std::optional<T> { return source.next(); }, it);
+}
+
+template <class T, class Source, class Key>
+template <class Other>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::hint(const Other& it)
+    -> std::optional<size_t>
+{
+    return it.sizeHint();
+}
+
+template <class T, class Source, class Key>
+template <class... Others>
+auto rusty_iterators::iterator::MergeSorted<T, Source, Key>::hint(
+    const std::variant<Others...>& it) -> std::optional<size_t>
+{
+    return std::visit([](const auto& source) { return source.sizeHint(); }, it);
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using concurrency::ThreadPool;
+using interface::IterInterface;
+
+/*
+ * Order preserving parallel `Map`. Items are pulled from the upstream in
+ * order and mapped on a thread pool, with at most `inFlight` of them being
+ * processed or waiting to be yielded at once. Results land in a ring of
+ * slots indexed by their position, so reordering costs no extra allocations.
+ *
+ * The callable is invoked concurrently from many threads, so it must be safe
+ * to do so.
+ */
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+class ParMap
+    : public IterInterface<std::invoke_result_t<Functor, Tin>, ParMap<Tin, Functor, Other>>
+{
+    using Tout = std::invoke_result_t<Functor, Tin>;
+
+  public:
+    ParMap(Other&& it, Functor&& f, size_t threads, size_t inFlight);
+    ~ParMap() override;
+
+    ParMap(const ParMap&)                    = delete;
+    auto operator=(const ParMap&) -> ParMap& = delete;
+    ParMap(ParMap&&) noexcept                = default;
+    auto operator=(ParMap&&) -> ParMap&      = delete;
+
+    [[nodiscard]] auto count() -> size_t;
+    auto next() -> std::optional<Tout>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    struct Slot
+    {
+        std::optional<Tout> value = std::nullopt;
+        std::exception_ptr error  = nullptr;
+        std::atomic<bool> ready   = false;
+    };
+
+    // Tasks refer to the callable and the slots, so those have a stable
+    // address. The pool is declared last, so it's joined first.
+    struct State
+    {
+        State(Functor&& f, size_t threads, size_t inFlight)
+            : func(std::forward<Functor>(f)), slots(inFlight), pool(threads)
+        {}
+
+        std::remove_cvref_t<Functor> func;
+        std::vector<Slot> slots;
+        ThreadPool pool;
+    };
+
+    Other it;
+    std::unique_ptr<State> state;
+    size_t head    = 0;
+    size_t tail    = 0;
+    bool exhausted = false;
+
+    auto discardPending() -> void;
+    auto fill() -> void;
+};
+} // namespace rusty_iterators::iterator
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+rusty_iterators::iterator::ParMap<Tin, Functor, Other>::ParMap(Other&& it, Functor&& f,
+                                                               size_t threads, size_t inFlight)
+    : it(std::forward<Other>(it))
+{
+    threads = ThreadPool::resolve(threads);
+
+    // By default every thread gets a few items ahead, so workers don't wait
+    // for each other when the mapping cost varies between items.
+    if (inFlight == 0)
+        inFlight = 4 * threads;
+
+    state = std::make_unique<State>(std::forward<Functor>(f), threads, inFlight);
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+rusty_iterators::iterator::ParMap<Tin, Functor, Other>::~ParMap()
+{
+    if (state)
+        discardPending();
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::ParMap<Tin, Functor, Other>::count() -> size_t
+{
+    // Same as for `Map`, items which weren't submitted yet are not mapped.
+    auto pending = tail - head;
+    discardPending();
+
+    return exhausted ? pending : pending + it.count();
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::ParMap<Tin, Functor, Other>::next() -> std::optional<Tout>
+{
+    fill();
+
+    [[unlikely]] if (head == tail)
+        return std::nullopt;
+
+    auto& slot = state->slots[head++ % state->slots.size()];
+
+    slot.ready.wait(false, std::memory_order_acquire);
+    slot.ready.store(false, std::memory_order_relaxed);
+
+    [[unlikely]] if (slot.error)
+        std::rethrow_exception(std::exchange(slot.error, nullptr));
+
+    auto item = std::move(slot.value);
+    slot.value.reset();
+
+    return item;
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::ParMap<Tin, Functor, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    // Map does not change the size of the underlying iterator, we only have to
+    // account for the items which were already pulled from it.
+    auto itSize = exhausted ? std::optional<size_t>{0} : it.sizeHint();
+
+    if (!itSize.has_value())
+        return std::nullopt;
+
+    return itSize.value() + (tail - head);
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::ParMap<Tin, Functor, Other>::discardPending() -> void
+{
+    for (; head != tail; head++)
+    {
+        auto& slot = state->slots[head % state->slots.size()];
+
+        slot.ready.wait(false, std::memory_order_acquire);
+        slot.ready.store(false, std::memory_order_relaxed);
+        slot.value.reset();
+        slot.error = nullptr;
+    }
+}
+
+template <class Tin, class Functor, class Other>
+    requires std::invocable<Functor, Tin&&>
+auto rusty_iterators::iterator::ParMap<Tin, Functor, Other>::fill() -> void
+{
+    while (!exhausted && tail - head < state->slots.size())
+    {
+        auto item = it.next();
+
+        [[unlikely]] if (!item.has_value())
+        {
+            exhausted = true;
+            break;
+        }
+        auto& slot = state->slots[tail++ % state->slots.size()];
+
+        state->pool.submit([&func = state->func, &slot, item = std::move(item.value())]() mutable {
+            try
+            {
+                slot.value.emplace(std::invoke(func, std::move(item)));
+            }
+            catch (...)
+            {
+                slot.error = std::current_exception();
+            }
+            slot.ready.store(true, std::memory_order_release);
+            slot.ready.notify_one();
+        });
+    }
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::radix
+{
+using iterator::Unwrapped;
+
+/*
+ * Maps a key to an unsigned integer of the same width, which orders the same
+ * way. Signed integers flip their sign bit. Negative floats flip all of their
+ * bits, so larger magnitudes come first, and positive floats only the sign
+ * bit, which puts `-0.0` before `0.0` and NaNs at the ends.
+ */
+template <class K>
+[[nodiscard]] constexpr auto toBits(K key)
+{
+    if constexpr (std::floating_point<K>)
+    {
+        using U = std::conditional_t<sizeof(K) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+        constexpr auto sign = U{1} << (8 * sizeof(U) - 1);
+        auto bits           = std::bit_cast<U>(key);
+
+        return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+    }
+    else if constexpr (std::signed_integral<K>)
+    {
+        using U = std::make_unsigned_t<K>;
+
+        return static_cast<U>(static_cast<U>(key) ^ (U{1} << (8 * sizeof(U) - 1)));
+    }
+    else
+    {
+        return key;
+    }
+}
+
+template <class K>
+using Bits = decltype(toBits(std::declval<K>()));
+
+template <class U, class Payload>
+struct Entry
+{
+    U key;
+    Payload payload;
+};
+
+/*
+ * Stable LSD radix sort of the items by the unsigned keys `bitsOf` gives
+ * them. Keys wider than 16 bits go 11 bits per pass, so a 32 bit key takes
+ * 3 passes and a 48 bit one 5, smaller keys a byte per pass. One histogram
+ * pass counts all the digits of all the keys upfront, and the passes in
+ * which every key has the same digit are skipped, so small keys in wide
+ * types only pay for their significant digits.
+ */
+template <class Item, class BitsOf>
+auto sortBy(std::vector<Item>& items, BitsOf bitsOf) -> void
+{
+    using U = std::invoke_result_t<BitsOf&, const Item&>;
+
+    constexpr size_t digitBits = sizeof(U) > 2 ? 11 : 8;
+    constexpr size_t radix     = size_t{1} << digitBits;
+    constexpr size_t passes    = (8 * sizeof(U) + digitBits - 1) / digitBits;
+
+    auto digit = [](U key, size_t pass) {
+        return static_cast<size_t>((key >> (digitBits * pass)) & (radix - 1));
+    };
+    auto counts = std::vector<std::array<size_t, radix>>(passes);
+
+    for (const auto& item : items)
+    {
+        auto key = bitsOf(item);
+
+        for (size_t pass = 0; pass < passes; pass++)
+            counts[pass][digit(key, pass)] += 1;
+    }
+
+    [[unlikely]] if (items.empty())
+        return;
+
+    auto scratch = std::vector<Item>(items.size());
+
+    for (size_t pass = 0; pass < passes; pass++)
+    {
+        auto& offsets = counts[pass];
+
+        if (offsets[digit(bitsOf(items.front()), pass)] == items.size())
+            continue;
+
+        std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), size_t{0});
+
+        for (auto& item : items)
+            scratch[offsets[digit(bitsOf(item), pass)]++] = std::move(item);
+
+        items.swap(scratch);
+    }
+}
+
+template <class U, class Payload>
+auto sortEntries(std::vector<Entry<U, Payload>>& entries) -> void
+{
+    sortBy(entries, [](const Entry<U, Payload>& entry) { return entry.key; });
+}
+
+/*
+ * Items grouped into `2^bits` buckets by the low bits of their keys. All the
+ * buckets share one buffer, in the order of their indices, and every bucket
+ * keeps its items in the order they came in.
+ */
+template <class T>
+class Partitions
+{
+  public:
+    explicit Partitions(std::vector<T>&& items, std::vector<size_t>&& offsets)
+        : items(std::move(items)), offsets(std::move(offsets))
+    {}
+
+    [[nodiscard]] auto bucket(size_t idx) -> std::span<T>;
+    [[nodiscard]] auto bucket(size_t idx) const -> std::span<const T>;
+    [[nodiscard]] auto bucketCount() const -> size_t { return offsets.size() - 1; }
+    [[nodiscard]] auto size() const -> size_t { return items.size(); }
+
+  private:
+    std::vector<T> items;
+    std::vector<size_t> offsets;
+};
+
+/*
+ * Scatters the items into their buckets with software write-combining: every
+ * bucket first collects a cache line worth of items in a small staging area,
+ * which is then copied out at once, so the scatter keeps a few hot lines
+ * instead of touching a distant page with every item.
+ */
+template <class T, class Key>
+    requires std::is_trivially_copyable_v<T> && std::default_initializable<T>
+[[nodiscard]] auto scatter(std::span<const T> items, size_t bits, Key& key) -> Partitions<T>
+{
+    using K = Unwrapped<std::invoke_result_t<Key&, const T&>>;
+
+    [[unlikely]] if (bits > 16)
+        throw std::invalid_argument{"Radix partitioning supports at most 16 bits."};
+
+    constexpr size_t lineItems = std::max(size_t{1}, size_t{64} / sizeof(T));
+
+    auto buckets  = size_t{1} << bits;
+    auto bucketOf = [&key, mask = buckets - 1](const T& item) {
+        return static_cast<size_t>(toBits(static_cast<K>(std::invoke(key, item))) & mask);
+    };
+
+    auto offsets = std::vector<size_t>(buckets + 1);
+
+    for (const auto& item : items)
+        offsets[bucketOf(item) + 1] += 1;
+
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    auto result  = std::vector<T>(items.size());
+    auto staged  = std::vector<T>(buckets * lineItems);
+    auto filled  = std::vector<size_t>(buckets);
+    auto cursors = std::vector<size_t>(offsets.begin(), offsets.end() - 1);
+
+    for (const auto& item : items)
+    {
+        auto bucket = bucketOf(item);
+        auto* line  = staged.data() + bucket * lineItems;
+
+        line[filled[bucket]++] = item;
+
+        [[unlikely]] if (filled[bucket] == lineItems)
+        {
+            std::copy_n(line, lineItems, result.data() + cursors[bucket]);
+            cursors[bucket] += lineItems;
+            filled[bucket] = 0;
+        }
+    }
+
+    for (size_t bucket = 0; bucket < buckets; bucket++)
+        std::copy_n(staged.data() + bucket * lineItems, filled[bucket],
+                    result.data() + cursors[bucket]);
+
+    return Partitions<T>{std::move(result), std::move(offsets)};
+}
+} // namespace rusty_iterators::radix
+
+template <class T>
+auto rusty_iterators::radix::Partitions<T>::bucket(size_t idx) -> std::span<T>
+{
+    [[unlikely]] if (idx >= bucketCount())
+        throw std::out_of_range{"Bucket index is out of range."};
+
+    return std::span<T>{items}.subspan(offsets[idx], offsets[idx + 1] - offsets[idx]);
+}
+
+template <class T>
+auto rusty_iterators::radix::Partitions<T>::bucket(size_t idx) const -> std::span<const T>
+{
+    [[unlikely]] if (idx >= bucketCount())
+        throw std::out_of_range{"Bucket index is out of range."};
+
+    return std::span<const T>{items}.subspan(offsets[idx], offsets[idx + 1] - offsets[idx]);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "hash.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace rusty_iterators::random
+{
+/*
+ * xoshiro256++ generator by Blackman and Vigna. Much faster than the
+ * `std::mt19937_64`, with a state of four words, and the same sequence for
+ * the same seed on every platform. Satisfies the uniform random bit
+ * generator requirements, so it can be used with the standard distributions.
+ */
+class Xoshiro256
+{
+  public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256(uint64_t seed);
+
+    [[nodiscard]] static constexpr auto min() -> result_type { return 0; }
+    [[nodiscard]] static constexpr auto max() -> result_type
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    auto operator()() -> result_type;
+
+    // Uniform in `[0, bound)`, `bound` has to be greater than zero.
+    [[nodiscard]] auto below(uint64_t bound) -> uint64_t;
+    // Uniform in `(0, 1]`, so its logarithm is always finite.
+    [[nodiscard]] auto unit() -> double;
+
+  private:
+    uint64_t state[4];
+};
+} // namespace rusty_iterators::random
+
+inline rusty_iterators::random::Xoshiro256::Xoshiro256(uint64_t seed)
+{
+    // Consecutive outputs of SplitMix64, as recommended by the authors, so
+    // similar seeds still give unrelated states, which are never all zero.
+    for (auto& word : state)
+    {
+        seed += 0x9e3779b97f4a7c15;
+        word = hashing::mix(seed);
+    }
+}
+
+inline auto rusty_iterators::random::Xoshiro256::operator()() -> result_type
+{
+    auto result = std::rotl(state[0] + state[3], 23) + state[0];
+    auto t      = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = std::rotl(state[3], 45);
+
+    return result;
+}
+
+inline auto rusty_iterators::random::Xoshiro256::below(uint64_t bound) -> uint64_t
+{
+    // Multiply and shift by Lemire instead of the slow division. The bias of
+    // both is negligible for the bounds much smaller than the 2^32 range.
+    [[likely]] if (bound <= std::numeric_limits<uint32_t>::max())
+        return (((*this)() >> 32) * bound) >> 32;
+
+    return (*this)() % bound;
+}
+
+inline auto rusty_iterators::random::Xoshiro256::unit() -> double
+{
+    // Top 53 bits fill the whole mantissa of a double.
+    return static_cast<double>(((*this)() >> 11) + 1) * 0x1.0p-53;
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.hpp"
+
+#include <concepts>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace rusty_iterators::iterator
+{
+using concepts::FoldFunctor;
+using concepts::ForEachFunctor;
+using interface::IterInterface;
+
+/*
+ * Arithmetic progression `start, start + step, ...` stopping before `stop`.
+ * Nothing is allocated and every element can be computed from its index, so
+ * the size is exact and most terminals have a closed form.
+ */
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+class Range : public IterInterface<T, Range<T>>
+{
+    // All the index arithmetic is done on unsigned values, which wrap instead
+    // of overflowing, the same way the element by element loop would. Small
+    // types are widened, otherwise they would be promoted to a signed `int`.
+    using U = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+
+  public:
+    static constexpr bool exactSize = true;
+
+    Range(T start, T stop, T step);
+
+    auto advanceBy(size_t amount) -> void;
+    [[nodiscard]] auto count() -> size_t;
+
+    template <class B, class Functor>
+        requires FoldFunctor<B, T, Functor>
+    [[nodiscard]] auto fold(B&& init, Functor&& f) -> B;
+
+    template <class Functor>
+        requires ForEachFunctor<T, Functor>
+    auto forEach(Functor&& f) -> void;
+
+    [[nodiscard]] auto last() -> std::optional<T>;
+    [[nodiscard]] auto max() -> std::optional<T>;
+    [[nodiscard]] auto min() -> std::optional<T>;
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+    [[nodiscard]] auto sum() -> T;
+
+  private:
+    T current;
+    T step;
+    size_t remaining = 0;
+
+    [[nodiscard]] inline auto at(size_t idx) const -> T
+    {
+        return static_cast<T>(static_cast<U>(current) +
+                              static_cast<U>(idx) * static_cast<U>(step));
+    }
+    [[nodiscard]] inline auto isIncreasing() const -> bool { return step > 0; }
+};
+
+template <std::integral T, std::integral S>
+[[nodiscard]] auto range(T start, S stop) -> Range<std::common_type_t<T, S>>
+{
+    using R = std::common_type_t<T, S>;
+    return Range<R>{static_cast<R>(start), static_cast<R>(stop), R{1}};
+}
+
+template <std::integral T, std::integral S>
+[[nodiscard]] auto range(T start, S stop, std::common_type_t<T, S> step)
+    -> Range<std::common_type_t<T, S>>
+{
+    using R = std::common_type_t<T, S>;
+    return Range<R>{static_cast<R>(start), static_cast<R>(stop), step};
+}
+} // namespace rusty_iterators::iterator
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+rusty_iterators::iterator::Range<T>::Range(T start, T stop, T step) : current(start), step(step)
+{
+    if (step == 0)
+        throw std::length_error{"Step can't be equal to zero."};
+
+    if (step > 0 && start < stop)
+        remaining = (static_cast<U>(stop) - static_cast<U>(start) - 1) / static_cast<U>(step) + 1;
+
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (step < 0 && start > stop)
+            remaining = (static_cast<U>(start) - static_cast<U>(stop) - 1) /
+                            (U{0} - static_cast<U>(step)) +
+                        1;
+    }
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::advanceBy(size_t amount) -> void
+{
+    [[unlikely]] if (amount >= remaining)
+    {
+        remaining = 0;
+        return;
+    }
+    current = at(amount);
+    remaining -= amount;
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::count() -> size_t
+{
+    return std::exchange(remaining, 0);
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+template <class B, class Functor>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Functor>
+auto rusty_iterators::iterator::Range<T>::fold(B&& init, Functor&& f) -> B
+{
+    // Counted loop without the optional returned by `next`, which compilers
+    // can unroll and vectorize.
+    auto func  = std::forward<Functor>(f);
+    auto accum = std::forward<B>(init);
+    auto size  = std::exchange(remaining, 0);
+
+    for (size_t i = 0; i < size; i++)
+        accum = func(std::move(accum), at(i));
+
+    return std::move(accum);
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+template <class Functor>
+    requires rusty_iterators::concepts::ForEachFunctor<T, Functor>
+auto rusty_iterators::iterator::Range<T>::forEach(Functor&& f) -> void
+{
+    auto func = std::forward<Functor>(f);
+    auto size = std::exchange(remaining, 0);
+
+    for (size_t i = 0; i < size; i++)
+        func(at(i));
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::last() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    return at(std::exchange(remaining, 0) - 1);
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::max() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    auto first = current;
+    auto last  = this->last();
+
+    return isIncreasing() ? last : first;
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::min() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    auto first = current;
+    auto last  = this->last();
+
+    return isIncreasing() ? first : last;
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::next() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    auto item = current;
+
+    // Stepping past the last element wraps around instead of overflowing.
+    remaining -= 1;
+    current = at(1);
+
+    return item;
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::sizeHint() const -> std::optional<size_t>
+{
+    return remaining;
+}
+
+template <class T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+auto rusty_iterators::iterator::Range<T>::sum() -> T
+{
+    // n * start + step * n * (n - 1) / 2, halving before the multiplication,
+    // because it can't be undone once the product wraps around.
+    auto size     = std::exchange(remaining, 0);
+    auto triangle = size % 2 == 0 ? (size / 2) * (size - 1) : size * ((size - 1) / 2);
+
+    return static_cast<T>(static_cast<U>(size) * static_cast<U>(current) +
+                          static_cast<U>(triangle) * static_cast<U>(step));
+}
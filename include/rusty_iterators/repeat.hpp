@@ -0,0 +1,105 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rusty_iterators::iterator
+{
+using concepts::Summable;
+using interface::IterInterface;
+
+// Yields copies of the same item forever.
+template <class T>
+class Repeat : public IterInterface<T, Repeat<T>>
+{
+  public:
+    explicit Repeat(T item) : item(std::move(item)) {}
+
+    auto advanceBy(size_t /*amount*/) -> void {}
+    auto next() -> std::optional<T> { return item; }
+    [[nodiscard]] auto nth(size_t /*element*/) -> std::optional<T> { return item; }
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return std::nullopt; }
+
+  private:
+    T item;
+};
+
+// Yields copies of the same item `n` times, moving it out on the last one.
+template <class T>
+class RepeatN : public IterInterface<T, RepeatN<T>>
+{
+  public:
+    RepeatN(T item, size_t amount) : item(std::move(item)), remaining(amount) {}
+
+    auto advanceBy(size_t amount) -> void { remaining -= std::min(amount, remaining); }
+    [[nodiscard]] auto count() -> size_t { return std::exchange(remaining, 0); }
+    [[nodiscard]] auto last() -> std::optional<T>;
+    [[nodiscard]] auto max() -> std::optional<T> { return last(); }
+    [[nodiscard]] auto min() -> std::optional<T> { return last(); }
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return remaining; }
+
+    template <class R = T>
+        requires Summable<R>
+    [[nodiscard]] auto sum() -> R;
+
+  private:
+    T item;
+    size_t remaining;
+};
+
+template <class T>
+[[nodiscard]] auto repeat(T item) -> Repeat<T>
+{
+    return Repeat<T>{std::move(item)};
+}
+
+template <class T>
+[[nodiscard]] auto repeatN(T item, size_t amount) -> RepeatN<T>
+{
+    return RepeatN<T>{std::move(item), amount};
+}
+} // namespace rusty_iterators::iterator
+
+template <class T>
+auto rusty_iterators::iterator::RepeatN<T>::last() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    remaining = 0;
+    return std::move(item);
+}
+
+template <class T>
+auto rusty_iterators::iterator::RepeatN<T>::next() -> std::optional<T>
+{
+    [[unlikely]] if (remaining == 0)
+        return std::nullopt;
+
+    remaining -= 1;
+
+    [[unlikely]] if (remaining == 0)
+        return std::move(item);
+
+    return item;
+}
+
+template <class T>
+template <class R>
+    requires rusty_iterators::concepts::Summable<R>
+auto rusty_iterators::iterator::RepeatN<T>::sum() -> R
+{
+    using Base = interface::IterInterface<T, RepeatN<T>>;
+
+    // Summing `n` equal numbers is a single multiplication.
+    if constexpr (std::is_arithmetic_v<R>)
+        return static_cast<R>(item) * static_cast<R>(std::exchange(remaining, 0));
+    else
+        return Base::template sum<R>();
+}
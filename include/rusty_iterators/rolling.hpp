@@ -0,0 +1,233 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.fwd.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using concepts::FoldFunctor;
+using interface::IterInterface;
+
+auto checkWindowSize(size_t size) -> void;
+auto rollingSizeHint(std::optional<size_t> itSize, size_t filled, size_t size)
+    -> std::optional<size_t>;
+
+/*
+ * Aggregates a sliding window of the last `size` items with an invertible
+ * operation. Every item is added once, when it enters the window, and
+ * removed once, when it leaves, so each step costs O(1) regardless of the
+ * window size.
+ */
+template <class T, class B, class Add, class Remove, class Other>
+    requires FoldFunctor<B, T, Add> && FoldFunctor<B, T, Remove>
+class RollingFold : public IterInterface<B, RollingFold<T, B, Add, Remove, Other>>
+{
+  public:
+    RollingFold(Other&& it, size_t size, B&& init, Add&& add, Remove&& remove)
+        : it(std::forward<Other>(it)), size(size), init(init), accum(std::forward<B>(init)),
+          add(std::forward<Add>(add)), remove(std::forward<Remove>(remove))
+    {
+        checkWindowSize(size);
+        window.reserve(size);
+    }
+
+    auto next() -> std::optional<B>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    size_t size;
+    B init;
+    B accum;
+    Add add;
+    Remove remove;
+    std::vector<T> window{};
+    size_t oldest = 0;
+
+    auto recompute() -> void;
+};
+
+/*
+ * Minimum (or maximum) of a sliding window, computed with a monotonic deque.
+ * Items which can never become the extremum, because a newer item is better,
+ * are dropped right away, so every item is pushed and popped at most once.
+ */
+template <class T, class Compare, class Other>
+class RollingExtremum : public IterInterface<Unwrapped<T>, RollingExtremum<T, Compare, Other>>
+{
+    using V = Unwrapped<T>;
+
+  public:
+    RollingExtremum(Other&& it, size_t size) : it(std::forward<Other>(it)), size(size)
+    {
+        checkWindowSize(size);
+    }
+
+    auto next() -> std::optional<V>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    struct Entry
+    {
+        size_t idx;
+        V value;
+    };
+
+    Other it;
+    size_t size;
+    std::deque<Entry> candidates{};
+    size_t seen = 0;
+    [[no_unique_address]] Compare compare{};
+};
+
+// Rolling sum divided by the window size.
+template <class T, class Other>
+class RollingMean : public IterInterface<double, RollingMean<T, Other>>
+{
+    using V    = Unwrapped<T>;
+    using Sums = RollingFold<T, V, std::plus<>, std::minus<>, Other>;
+
+  public:
+    RollingMean(Other&& it, size_t size)
+        : sums(std::forward<Other>(it), size, V{}, std::plus<>{}, std::minus<>{}), size(size)
+    {}
+
+    auto next() -> std::optional<double>
+    {
+        auto sum = sums.next();
+
+        [[unlikely]] if (!sum.has_value())
+            return std::nullopt;
+
+        return static_cast<double>(sum.value()) / static_cast<double>(size);
+    }
+
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return sums.sizeHint(); }
+
+  private:
+    Sums sums;
+    size_t size;
+};
+} // namespace rusty_iterators::iterator
+
+inline auto rusty_iterators::iterator::checkWindowSize(size_t size) -> void
+{
+    if (size == 0)
+        throw std::length_error{"Rolling window size must be greater than zero."};
+}
+
+inline auto rusty_iterators::iterator::rollingSizeHint(std::optional<size_t> itSize,
+                                                       size_t filled, size_t size)
+    -> std::optional<size_t>
+{
+    // There is one output for every item, once the first window is filled.
+    if (!itSize.has_value() || filled == size)
+        return itSize;
+
+    auto missing = size - filled;
+    return itSize.value() >= missing ? itSize.value() - missing + 1 : 0;
+}
+
+template <class T, class B, class Add, class Remove, class Other>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Add> &&
+             rusty_iterators::concepts::FoldFunctor<B, T, Remove>
+auto rusty_iterators::iterator::RollingFold<T, B, Add, Remove, Other>::next() -> std::optional<B>
+{
+    [[likely]] if (window.size() == size)
+    {
+        auto item = it.next();
+
+        [[unlikely]] if (!item.has_value())
+            return std::nullopt;
+
+        accum          = remove(std::move(accum), window[oldest]);
+        accum          = add(std::move(accum), item.value());
+        window[oldest] = std::move(item.value());
+        oldest         = (oldest + 1) % size;
+
+        // Removing floating point numbers doesn't cancel their rounding
+        // errors, so once per window we sum it again from scratch, which
+        // keeps the amortized cost constant.
+        if constexpr (std::floating_point<B>)
+        {
+            if (oldest == 0)
+                recompute();
+        }
+        return accum;
+    }
+
+    while (window.size() < size)
+    {
+        auto item = it.next();
+
+        [[unlikely]] if (!item.has_value())
+            return std::nullopt;
+
+        accum = add(std::move(accum), item.value());
+        window.push_back(std::move(item.value()));
+    }
+    return accum;
+}
+
+template <class T, class B, class Add, class Remove, class Other>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Add> &&
+             rusty_iterators::concepts::FoldFunctor<B, T, Remove>
+auto rusty_iterators::iterator::RollingFold<T, B, Add, Remove, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    return rollingSizeHint(it.sizeHint(), window.size(), size);
+}
+
+template <class T, class B, class Add, class Remove, class Other>
+    requires rusty_iterators::concepts::FoldFunctor<B, T, Add> &&
+             rusty_iterators::concepts::FoldFunctor<B, T, Remove>
+auto rusty_iterators::iterator::RollingFold<T, B, Add, Remove, Other>::recompute() -> void
+{
+    accum = init;
+
+    for (const auto& item : window)
+        accum = add(std::move(accum), item);
+}
+
+template <class T, class Compare, class Other>
+auto rusty_iterators::iterator::RollingExtremum<T, Compare, Other>::next() -> std::optional<V>
+{
+    do
+    {
+        auto item = it.next();
+
+        [[unlikely]] if (!item.has_value())
+            return std::nullopt;
+
+        auto value = static_cast<V>(item.value());
+
+        while (!candidates.empty() && !compare(candidates.back().value, value))
+            candidates.pop_back();
+
+        candidates.push_back(Entry{seen, std::move(value)});
+        seen += 1;
+
+        // Indices only grow, so at most one candidate leaves the window.
+        if (candidates.front().idx + size < seen)
+            candidates.pop_front();
+    } while (seen < size);
+
+    return candidates.front().value;
+}
+
+template <class T, class Compare, class Other>
+auto rusty_iterators::iterator::RollingExtremum<T, Compare, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    return rollingSizeHint(it.sizeHint(), std::min(seen, size), size);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+#include "random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+using random::Xoshiro256;
+
+/*
+ * Bernoulli sample, every item is kept with the given probability, in order.
+ * Instead of drawing a number for every item, we draw the geometrically
+ * distributed gap to the next kept one and skip it with `advanceBy`, so
+ * random access sources don't even touch the items which are not selected.
+ */
+template <class T, class Other>
+class Sample : public IterInterface<T, Sample<T, Other>>
+{
+  public:
+    Sample(Other&& it, double probability, uint64_t seed);
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    double probability;
+    double logOfMiss;
+    Xoshiro256 rng;
+};
+
+/*
+ * Number of items to skip before the next selected one, when every item is
+ * skipped with the probability `exp(logOfMiss)`. Shared with `reservoir`.
+ */
+[[nodiscard]] inline auto geometricGap(Xoshiro256& rng, double logOfMiss) -> size_t
+{
+    // Huge gaps are clamped, skipping past the end is all that matters then.
+    static constexpr auto limit = static_cast<double>(std::numeric_limits<ptrdiff_t>::max() / 2);
+
+    auto gap = std::floor(std::log(rng.unit()) / logOfMiss);
+    return static_cast<size_t>(std::min(gap, limit));
+}
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+rusty_iterators::iterator::Sample<T, Other>::Sample(Other&& it, double probability, uint64_t seed)
+    : it(std::forward<Other>(it)), probability(probability), logOfMiss(std::log1p(-probability)),
+      rng(seed)
+{
+    if (!(probability >= 0 && probability <= 1))
+        throw std::invalid_argument{"Sampling probability has to be between 0 and 1."};
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Sample<T, Other>::next() -> std::optional<T>
+{
+    [[unlikely]] if (probability == 0)
+        return std::nullopt;
+
+    [[unlikely]] if (probability == 1)
+        return it.next();
+
+    return it.nth(geometricGap(rng, logOfMiss));
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Sample<T, Other>::sizeHint() const -> std::optional<size_t>
+{
+    if (probability == 1)
+        return it.sizeHint();
+
+    // The number of sampled items is random, only infinity is certain.
+    if (probability > 0 && !it.sizeHint().has_value())
+        return std::nullopt;
+
+    return 0;
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.fwd.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using concepts::ContiguousOf;
+using concurrency::ThreadPool;
+using interface::IterInterface;
+
+enum class ScanType : uint8_t
+{
+    Exclusive,
+    Inclusive,
+};
+
+/*
+ * Yields the accumulator after every item was folded into it, like a `fold`
+ * which reports its progress, without a mutable capture in `map`.
+ */
+template <class T, class B, class Functor, class Other>
+class Scan : public IterInterface<B, Scan<T, B, Functor, Other>>
+{
+  public:
+    explicit Scan(Other&& it, B init, Functor&& f)
+        : it(std::forward<Other>(it)), accum(std::move(init)), func(std::forward<Functor>(f))
+    {}
+
+    [[nodiscard]] auto count() -> size_t;
+    auto next() -> std::optional<B>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    B accum;
+    Functor func;
+};
+
+/*
+ * Running sums of the items. The inclusive sum at every position counts the
+ * item itself, the exclusive one only the items before it, which makes it
+ * the offsets of variable length records from their lengths.
+ *
+ * Contiguous sources are summed a block at a time, straight from their
+ * memory and without the optional returned by `next`.
+ */
+template <class T, class R, class Other, ScanType type>
+class PrefixSum : public IterInterface<R, PrefixSum<T, R, Other, type>>
+{
+    static constexpr bool isContiguous = ContiguousOf<Other, R>;
+
+  public:
+    explicit PrefixSum(Other&& it) : it(std::forward<Other>(it)) {}
+
+    [[nodiscard]] auto count() -> size_t;
+    auto next() -> std::optional<R>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    static constexpr size_t blockSize = 256;
+
+    Other it;
+    R total{};
+    std::array<R, isContiguous ? blockSize : 0> block{};
+    size_t position = 0;
+    size_t filled   = 0;
+
+    auto refill() -> void;
+};
+
+// Writes the running sums of the items into `out`, starting from `carry`, and
+// returns the sum of everything.
+template <class R>
+auto scanInto(std::span<const R> items, std::span<R> out, R carry, ScanType type) -> R
+{
+    if (type == ScanType::Inclusive)
+    {
+        for (size_t i = 0; i < items.size(); i++)
+        {
+            carry  = carry + items[i];
+            out[i] = carry;
+        }
+        return carry;
+    }
+
+    for (size_t i = 0; i < items.size(); i++)
+    {
+        out[i] = carry;
+        carry  = carry + items[i];
+    }
+    return carry;
+}
+
+/*
+ * Two pass parallel prefix sum. Every thread sums its own chunk first, the
+ * totals of the chunks are scanned serially, and then every thread scans its
+ * chunk again, starting from the total of all the chunks before it. Items
+ * are read twice, so it only pays off for arrays well beyond the caches, and
+ * floating point sums may differ from a serial scan in the last bits.
+ */
+template <class R>
+auto parallelPrefixSum(std::span<const R> items, std::span<R> out, ScanType type,
+                       size_t threads) -> void
+{
+    constexpr size_t minChunk = size_t{1} << 16;
+
+    [[unlikely]] if (out.size() != items.size())
+        throw std::length_error{"Prefix sums need an output of the same size as the input."};
+
+    auto chunks = std::min(ThreadPool::resolve(threads), items.size() / minChunk);
+
+    if (chunks <= 1)
+    {
+        scanInto(items, out, R{}, type);
+        return;
+    }
+
+    auto chunkSize = (items.size() + chunks - 1) / chunks;
+    auto totals    = std::vector<R>(chunks);
+    auto pool      = ThreadPool{chunks};
+
+    auto runAll = [&pool, chunks](auto task) {
+        auto done = std::latch{static_cast<std::ptrdiff_t>(chunks)};
+
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            pool.submit([&task, &done, chunk] {
+                task(chunk);
+                done.count_down();
+            });
+        }
+        done.wait();
+    };
+    auto chunkOf = [&items, chunkSize](size_t chunk) {
+        auto first = std::min(chunk * chunkSize, items.size());
+        return std::pair{first, std::min(chunkSize, items.size() - first)};
+    };
+
+    runAll([&](size_t chunk) {
+        auto [first, size] = chunkOf(chunk);
+        totals[chunk]      = std::reduce(items.begin() + first, items.begin() + first + size, R{});
+    });
+
+    std::exclusive_scan(totals.begin(), totals.end(), totals.begin(), R{});
+
+    runAll([&](size_t chunk) {
+        auto [first, size] = chunkOf(chunk);
+        scanInto(items.subspan(first, size), out.subspan(first, size), totals[chunk], type);
+    });
+}
+} // namespace rusty_iterators::iterator
+
+template <class T, class B, class Functor, class Other>
+auto rusty_iterators::iterator::Scan<T, B, Functor, Other>::count() -> size_t
+{
+    // Same as `Map`, the accumulator is not needed just to count.
+    return it.count();
+}
+
+template <class T, class B, class Functor, class Other>
+auto rusty_iterators::iterator::Scan<T, B, Functor, Other>::next() -> std::optional<B>
+{
+    auto nextItem = it.next();
+
+    [[unlikely]] if (!nextItem.has_value())
+        return std::nullopt;
+
+    accum = func(std::move(accum), std::move(nextItem.value()));
+
+    return accum;
+}
+
+template <class T, class B, class Functor, class Other>
+auto rusty_iterators::iterator::Scan<T, B, Functor, Other>::sizeHint() const
+    -> std::optional<size_t>
+{
+    return it.sizeHint();
+}
+
+template <class T, class R, class Other, rusty_iterators::iterator::ScanType type>
+auto rusty_iterators::iterator::PrefixSum<T, R, Other, type>::count() -> size_t
+{
+    return filled - position + it.count();
+}
+
+template <class T, class R, class Other, rusty_iterators::iterator::ScanType type>
+auto rusty_iterators::iterator::PrefixSum<T, R, Other, type>::next() -> std::optional<R>
+{
+    if constexpr (isContiguous)
+    {
+        [[unlikely]] if (position == filled)
+        {
+            refill();
+
+            if (filled == 0)
+                return std::nullopt;
+        }
+        return block[position++];
+    }
+    else
+    {
+        auto nextItem = it.next();
+
+        [[unlikely]] if (!nextItem.has_value())
+            return std::nullopt;
+
+        auto before = total;
+        total       = total + static_cast<const R&>(nextItem.value());
+
+        return type == ScanType::Inclusive ? total : before;
+    }
+}
+
+template <class T, class R, class Other, rusty_iterators::iterator::ScanType type>
+auto rusty_iterators::iterator::PrefixSum<T, R, Other, type>::sizeHint() const
+    -> std::optional<size_t>
+{
+    auto size = it.sizeHint();
+
+    if (!size.has_value())
+        return std::nullopt;
+
+    return size.value() + filled - position;
+}
+
+template <class T, class R, class Other, rusty_iterators::iterator::ScanType type>
+auto rusty_iterators::iterator::PrefixSum<T, R, Other, type>::refill() -> void
+{
+    auto slice = it.asSlice();
+
+    filled   = std::min(slice.size(), blockSize);
+    position = 0;
+    total    = scanInto(slice.first(filled), std::span<R>{block}.first(filled), total, type);
+
+    it.advanceBy(filled);
+}
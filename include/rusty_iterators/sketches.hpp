@@ -0,0 +1,353 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::statistics
+{
+using concepts::HashFunctor;
+
+/*
+ * Blocked Bloom filter, every key sets eight bits in a single 64 byte block,
+ * one in each of its words. A probe touches one cache line, the eight bit
+ * positions are independent multiplications of the lower half of the hash,
+ * while the upper half selects the block. With the default 10 bits per key
+ * about 1% of the absent keys are reported as present, present keys always
+ * are. Filters of the same size can be merged.
+ *
+ * Keys are added by their 64 bit hash, which has to be well distributed and
+ * the same for building and probing.
+ */
+class BloomFilter
+{
+  public:
+    explicit BloomFilter(size_t keys, double bitsPerKey = 10);
+
+    auto add(uint64_t hash) -> void;
+    auto merge(const BloomFilter& other) -> void;
+
+    [[nodiscard]] auto mayContain(uint64_t hash) const -> bool;
+
+  private:
+    struct alignas(64) Block
+    {
+        std::array<uint64_t, 8> words;
+    };
+
+    std::vector<Block> blocks;
+
+    [[nodiscard]] auto blockOf(uint64_t hash) const -> size_t;
+    [[nodiscard]] static auto masksOf(uint64_t hash) -> Block;
+};
+
+/*
+ * HyperLogLog estimate of the number of distinct values, by Flajolet et al.
+ * Uses `2^precision` one byte registers, with the relative error of about
+ * `1.04 / sqrt(2^precision)`, so the default precision takes 4KB and is off
+ * by less than 2%. Sketches with the same precision can be merged.
+ *
+ * Values are added by their 64 bit hash, which has to be well distributed.
+ */
+class HyperLogLog
+{
+  public:
+    explicit HyperLogLog(uint8_t precision = 12);
+
+    auto add(uint64_t hash) -> void;
+    auto merge(const HyperLogLog& other) -> void;
+
+    [[nodiscard]] auto estimate() const -> size_t;
+
+  private:
+    uint8_t precision;
+    std::vector<uint8_t> registers;
+};
+
+template <class T>
+struct HeavyHitter
+{
+    T item;
+    size_t count;
+    // Upper bound of the overestimation, `count - error` is guaranteed.
+    size_t error;
+};
+
+/*
+ * Space-Saving algorithm by Metwally et al. Keeps exactly `capacity`
+ * counters. An item without a counter takes over the smallest one, and
+ * inherits its count as the possible error, so every item occurring more
+ * than `n / capacity` times is guaranteed to be reported.
+ *
+ * Counters are kept in a min heap indexed by the hash map, so each update
+ * costs O(log capacity).
+ */
+template <class T, class Hasher = hashing::Hash<T>>
+    requires HashFunctor<T, Hasher>
+class SpaceSaving
+{
+  public:
+    explicit SpaceSaving(size_t capacity, Hasher hasher = Hasher{});
+
+    auto add(const T& item, size_t weight = 1) -> void;
+    auto merge(const SpaceSaving& other) -> void;
+
+    [[nodiscard]] auto top() const -> std::vector<HeavyHitter<T>>;
+
+  private:
+    struct Hash
+    {
+        Hasher hasher;
+        [[nodiscard]] auto operator()(const T& item) const -> size_t
+        {
+            return static_cast<size_t>(hasher(item));
+        }
+    };
+
+    size_t capacity;
+    std::vector<HeavyHitter<T>> heap{};
+    std::unordered_map<T, size_t, Hash> positions;
+
+    auto siftDown(size_t idx) -> void;
+    auto siftUp(size_t idx) -> void;
+    auto swap(size_t first, size_t second) -> void;
+};
+} // namespace rusty_iterators::statistics
+
+inline rusty_iterators::statistics::BloomFilter::BloomFilter(size_t keys, double bitsPerKey)
+{
+    if (!(bitsPerKey > 0) || !std::isfinite(bitsPerKey))
+        throw std::invalid_argument{"Bloom filter needs a positive number of bits per key."};
+
+    auto bits = std::ceil(static_cast<double>(keys) * bitsPerKey / 512);
+    blocks.resize(std::max(static_cast<size_t>(bits), size_t{1}), Block{});
+}
+
+inline auto rusty_iterators::statistics::BloomFilter::add(uint64_t hash) -> void
+{
+    auto& block = blocks[blockOf(hash)];
+    auto masks  = masksOf(hash);
+
+    for (size_t i = 0; i < block.words.size(); i++)
+        block.words[i] |= masks.words[i];
+}
+
+inline auto rusty_iterators::statistics::BloomFilter::merge(const BloomFilter& other) -> void
+{
+    if (blocks.size() != other.blocks.size())
+        throw std::invalid_argument{"Only filters of the same size can be merged."};
+
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (size_t j = 0; j < blocks[i].words.size(); j++)
+            blocks[i].words[j] |= other.blocks[i].words[j];
+    }
+}
+
+inline auto rusty_iterators::statistics::BloomFilter::mayContain(uint64_t hash) const -> bool
+{
+    const auto& block = blocks[blockOf(hash)];
+    auto masks        = masksOf(hash);
+    uint64_t missing  = 0;
+
+    // No early exit, so the loop compiles to a few vector instructions.
+    for (size_t i = 0; i < block.words.size(); i++)
+        missing |= masks.words[i] & ~block.words[i];
+
+    return missing == 0;
+}
+
+inline auto rusty_iterators::statistics::BloomFilter::blockOf(uint64_t hash) const -> size_t
+{
+    // Maps the upper half of the hash onto the blocks without a division.
+    return static_cast<size_t>(((hash >> 32) * blocks.size()) >> 32);
+}
+
+inline auto rusty_iterators::statistics::BloomFilter::masksOf(uint64_t hash) -> Block
+{
+    // Odd constants of the split block Bloom filter from Apache Parquet.
+    static constexpr auto salts = std::array<uint32_t, 8>{
+        0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+        0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31,
+    };
+
+    auto key   = static_cast<uint32_t>(hash);
+    auto masks = Block{};
+
+    for (size_t i = 0; i < salts.size(); i++)
+        masks.words[i] = uint64_t{1} << (static_cast<uint32_t>(key * salts[i]) >> 26);
+
+    return masks;
+}
+
+inline rusty_iterators::statistics::HyperLogLog::HyperLogLog(uint8_t precision)
+    : precision(precision)
+{
+    if (precision < 4 || precision > 18)
+        throw std::length_error{"HyperLogLog precision has to be between 4 and 18."};
+
+    registers.resize(size_t{1} << precision, 0);
+}
+
+inline auto rusty_iterators::statistics::HyperLogLog::add(uint64_t hash) -> void
+{
+    // Top bits select the register, the rest is a geometric trial. The guard
+    // bit caps the rank, when all the remaining bits are zero.
+    auto idx  = hash >> (64 - precision);
+    auto rest = (hash << precision) | (uint64_t{1} << (precision - 1));
+    auto rank = static_cast<uint8_t>(std::countl_zero(rest) + 1);
+
+    registers[idx] = std::max(registers[idx], rank);
+}
+
+inline auto rusty_iterators::statistics::HyperLogLog::merge(const HyperLogLog& other) -> void
+{
+    if (precision != other.precision)
+        throw std::invalid_argument{"Only sketches with the same precision can be merged."};
+
+    for (size_t i = 0; i < registers.size(); i++)
+        registers[i] = std::max(registers[i], other.registers[i]);
+}
+
+inline auto rusty_iterators::statistics::HyperLogLog::estimate() const -> size_t
+{
+    auto m      = static_cast<double>(registers.size());
+    auto sum    = 0.0;
+    size_t zero = 0;
+
+    for (auto reg : registers)
+    {
+        sum += std::ldexp(1.0, -reg);
+        zero += reg == 0;
+    }
+
+    auto alpha    = 0.7213 / (1 + 1.079 / m);
+    auto estimate = alpha * m * m / sum;
+
+    // The raw estimate is biased for small cardinalities, while there are
+    // still empty registers linear counting is much more accurate.
+    if (estimate <= 2.5 * m && zero > 0)
+        estimate = m * std::log(m / static_cast<double>(zero));
+
+    return static_cast<size_t>(std::llround(estimate));
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+rusty_iterators::statistics::SpaceSaving<T, Hasher>::SpaceSaving(size_t capacity, Hasher hasher)
+    : capacity(capacity), positions(0, Hash{std::move(hasher)})
+{
+    if (capacity == 0)
+        throw std::length_error{"Space-Saving needs at least one counter."};
+
+    heap.reserve(capacity);
+    positions.reserve(capacity);
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::add(const T& item, size_t weight) -> void
+{
+    auto found = positions.find(item);
+
+    [[likely]] if (found != positions.end())
+    {
+        heap[found->second].count += weight;
+        siftDown(found->second);
+        return;
+    }
+
+    [[unlikely]] if (heap.size() < capacity)
+    {
+        heap.push_back(HeavyHitter<T>{item, weight, 0});
+        positions.emplace(item, heap.size() - 1);
+        siftUp(heap.size() - 1);
+        return;
+    }
+
+    auto& smallest = heap.front();
+
+    positions.erase(smallest.item);
+    positions.emplace(item, 0);
+
+    smallest = HeavyHitter<T>{item, smallest.count + weight, smallest.count};
+    siftDown(0);
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::merge(const SpaceSaving& other) -> void
+{
+    for (const auto& hitter : other.top())
+        add(hitter.item, hitter.count);
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::top() const
+    -> std::vector<HeavyHitter<T>>
+{
+    auto result = heap;
+    std::ranges::stable_sort(result, std::ranges::greater{}, &HeavyHitter<T>::count);
+
+    return result;
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::siftDown(size_t idx) -> void
+{
+    while (true)
+    {
+        auto smallest = idx;
+
+        for (auto child : {2 * idx + 1, 2 * idx + 2})
+        {
+            if (child < heap.size() && heap[child].count < heap[smallest].count)
+                smallest = child;
+        }
+
+        [[likely]] if (smallest == idx)
+            return;
+
+        swap(idx, smallest);
+        idx = smallest;
+    }
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::siftUp(size_t idx) -> void
+{
+    while (idx > 0)
+    {
+        auto parent = (idx - 1) / 2;
+
+        [[likely]] if (heap[parent].count <= heap[idx].count)
+            return;
+
+        swap(idx, parent);
+        idx = parent;
+    }
+}
+
+template <class T, class Hasher>
+    requires rusty_iterators::concepts::HashFunctor<T, Hasher>
+auto rusty_iterators::statistics::SpaceSaving<T, Hasher>::swap(size_t first, size_t second)
+    -> void
+{
+    std::swap(heap[first], heap[second]);
+
+    positions.find(heap[first].item)->second  = first;
+    positions.find(heap[second].item)->second = second;
+}
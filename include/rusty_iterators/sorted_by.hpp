@@ -0,0 +1,277 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+#include "merge_sorted.hpp"
+#include "random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+
+/*
+ * Sorted items written to a temporary file, which is deleted when closed.
+ * The file is created in `directory`, or by `std::tmpfile` when it is empty.
+ * Items are stored as raw bytes and read back in fixed size blocks.
+ */
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+class SpilledRun
+{
+  public:
+    SpilledRun(std::span<const T> items, const std::filesystem::path& directory);
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    struct Close
+    {
+        std::filesystem::path path{};
+
+        auto operator()(std::FILE* file) const -> void
+        {
+            std::fclose(file);
+
+            if (!path.empty())
+            {
+                auto error = std::error_code{};
+                std::filesystem::remove(path, error);
+            }
+        }
+    };
+    using File = std::unique_ptr<std::FILE, Close>;
+
+    static constexpr size_t blockItems = std::max(size_t{1}, (size_t{1} << 16) / sizeof(T));
+
+    File file;
+    std::vector<std::byte> block{};
+    size_t position  = 0;
+    size_t available = 0;
+    size_t remaining = 0;
+
+    auto refill() -> void;
+
+    [[nodiscard]] static auto open(const std::filesystem::path& directory) -> File;
+};
+
+/*
+ * Sorts the items by key, even when they don't fit in memory. Items are read
+ * into a buffer of `memoryBudget` bytes, and if the iterator ends before it
+ * fills up, they are simply sorted in place. Otherwise every full buffer is
+ * sorted and spilled to a temporary file, and the files are lazily merged.
+ * The sort is stable, which may take up to another budget of scratch space.
+ *
+ * Spilled files go to `spillDir` when it is set, e.g. when the default
+ * temporary directory lives in memory.
+ */
+template <class T, class Key, class Other>
+    requires std::is_trivially_copyable_v<T>
+class SortedBy : public IterInterface<T, SortedBy<T, Key, Other>>
+{
+  public:
+    static constexpr size_t defaultMemoryBudget = size_t{256} << 20;
+
+    explicit SortedBy(Other&& it, Key&& key, size_t memoryBudget, std::filesystem::path spillDir)
+        : it(std::forward<Other>(it)), key(std::forward<Key>(key)),
+          capacity(std::max(memoryBudget / sizeof(T), size_t{1})), spillDir(std::move(spillDir))
+    {}
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    Other it;
+    Key key;
+    size_t capacity;
+    std::filesystem::path spillDir;
+    std::vector<T> buffer{};
+    size_t position = 0;
+    std::optional<MergeSorted<T, SpilledRun<T>, Key>> runs = std::nullopt;
+    bool started                                           = false;
+
+    auto sortBuffer() -> void;
+    auto start() -> void;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+rusty_iterators::iterator::SpilledRun<T>::SpilledRun(std::span<const T> items,
+                                                     const std::filesystem::path& directory)
+    : file(open(directory)), remaining(items.size())
+{
+    if (std::fwrite(items.data(), sizeof(T), items.size(), file.get()) != items.size())
+        throw std::runtime_error{"Could not write a sorted run."};
+
+    std::rewind(file.get());
+}
+
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SpilledRun<T>::next() -> std::optional<T>
+{
+    [[unlikely]] if (position == available)
+    {
+        if (remaining == 0)
+            return std::nullopt;
+
+        refill();
+    }
+
+    // Types without a default constructor can't be read into directly.
+    auto bytes = std::array<std::byte, sizeof(T)>{};
+    std::memcpy(bytes.data(), block.data() + position * sizeof(T), sizeof(T));
+    position += 1;
+
+    return std::bit_cast<T>(bytes);
+}
+
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SpilledRun<T>::sizeHint() const -> std::optional<size_t>
+{
+    return remaining + available - position;
+}
+
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SpilledRun<T>::refill() -> void
+{
+    available = std::min(remaining, blockItems);
+    block.resize(available * sizeof(T));
+
+    if (std::fread(block.data(), sizeof(T), available, file.get()) != available)
+        throw std::runtime_error{"Could not read a sorted run."};
+
+    remaining -= available;
+    position = 0;
+}
+
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SpilledRun<T>::open(const std::filesystem::path& directory) -> File
+{
+    if (directory.empty())
+    {
+        auto file = File{std::tmpfile()};
+
+        if (!file)
+            throw std::runtime_error{"Could not create a temporary file."};
+
+        return file;
+    }
+
+    // Random names, opened in exclusive mode, so concurrent sorts never
+    // share a file. A few retries are enough to get past a collision.
+    constexpr size_t attempts = 16;
+    auto rng                  = random::Xoshiro256{std::random_device{}()};
+
+    for (size_t i = 0; i < attempts; i++)
+    {
+        auto path = directory / ("rusty_iterators_" + std::to_string(rng()) + ".run");
+        auto file = File{std::fopen(path.string().c_str(), "w+bx"), Close{path}};
+
+        if (file)
+            return file;
+    }
+    throw std::runtime_error{"Could not create a temporary file in the spill directory."};
+}
+
+template <class T, class Key, class Other>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SortedBy<T, Key, Other>::next() -> std::optional<T>
+{
+    [[unlikely]] if (!started)
+    {
+        start();
+        started = true;
+    }
+
+    if (runs.has_value())
+        return runs->next();
+
+    [[unlikely]] if (position == buffer.size())
+        return std::nullopt;
+
+    return buffer[position++];
+}
+
+template <class T, class Key, class Other>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SortedBy<T, Key, Other>::sizeHint() const -> std::optional<size_t>
+{
+    if (!started)
+        return it.sizeHint();
+
+    if (runs.has_value())
+        return runs->sizeHint();
+
+    return buffer.size() - position;
+}
+
+template <class T, class Key, class Other>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SortedBy<T, Key, Other>::sortBuffer() -> void
+{
+    using K = std::remove_cvref_t<
+        std::unwrap_reference_t<std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>>>;
+
+    std::ranges::stable_sort(buffer, [this](const T& a, const T& b) {
+        return static_cast<const K&>(std::invoke(key, a)) <
+               static_cast<const K&>(std::invoke(key, b));
+    });
+}
+
+template <class T, class Key, class Other>
+    requires std::is_trivially_copyable_v<T>
+auto rusty_iterators::iterator::SortedBy<T, Key, Other>::start() -> void
+{
+    auto spilled = std::vector<SpilledRun<T>>{};
+
+    buffer.reserve(std::min(capacity, it.sizeHint().value_or(0)));
+
+    // The buffer is spilled only when one more item arrives, so inputs of
+    // exactly the budget are still sorted in memory.
+    it.forEach([this, &spilled](auto x) {
+        [[unlikely]] if (buffer.size() == capacity)
+        {
+            sortBuffer();
+            spilled.emplace_back(std::span<const T>{buffer}, spillDir);
+            buffer.clear();
+        }
+        buffer.push_back(std::move(x));
+    });
+
+    // Inputs which fit are sorted at once. Sorting cache sized runs and
+    // merging them with the loser tree was measured to be slower, since the
+    // merge costs a few unpredictable comparisons for every item.
+    sortBuffer();
+
+    if (spilled.empty())
+        return;
+
+    spilled.emplace_back(std::span<const T>{buffer}, spillDir);
+    buffer = std::vector<T>{};
+
+    // Runs hold the consecutive parts of the input and the merge prefers the
+    // earlier run on ties, which keeps the sort stable. The merge gets its own
+    // copy of the key, unless we only hold a reference to it.
+    runs.emplace(std::move(spilled), static_cast<Key>(key));
+}
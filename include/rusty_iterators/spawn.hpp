@@ -0,0 +1,152 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+#include "spsc_ring.hpp"
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using concurrency::SpscRing;
+using interface::IterInterface;
+
+/*
+ * Runs the upstream iterator on a worker thread. Items are sent in batches
+ * through a bounded ring, so the worker can run ahead by at most `capacity`
+ * batches, while the synchronization cost is paid once per batch.
+ *
+ * Exceptions thrown on the worker are rethrown by `next`. Dropping the
+ * iterator early cancels the ring and joins the worker, which stops after
+ * finishing the item it is currently producing.
+ */
+template <class T, class Other>
+class Spawn : public IterInterface<T, Spawn<T, Other>>
+{
+  public:
+    static constexpr size_t defaultBatchSize = 1024;
+
+    Spawn(Other&& it, size_t capacity, size_t batchSize);
+    ~Spawn() override;
+
+    Spawn(const Spawn&)                    = delete;
+    auto operator=(const Spawn&) -> Spawn& = delete;
+    Spawn(Spawn&&) noexcept                = default;
+    auto operator=(Spawn&&) -> Spawn&      = delete;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    using Batch = std::vector<T>;
+
+    struct State
+    {
+        explicit State(size_t capacity) : ring(capacity) {}
+
+        SpscRing<Batch> ring;
+        std::exception_ptr error = nullptr;
+    };
+
+    std::unique_ptr<State> state;
+    std::jthread worker;
+    Batch current{};
+    size_t position = 0;
+    std::optional<size_t> remaining;
+
+    static auto produce(State& state, Other it, size_t batchSize) -> void;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+rusty_iterators::iterator::Spawn<T, Other>::Spawn(Other&& it, size_t capacity, size_t batchSize)
+    : state(std::make_unique<State>(capacity)), remaining(it.sizeHint())
+{
+    if (batchSize == 0)
+        throw std::length_error{"Batch size has to be greater than zero."};
+
+    // The worker only touches the heap allocated state and its own copy of
+    // the upstream iterator, so moving `Spawn` around is safe.
+    worker = std::jthread{produce, std::ref(*state), std::forward<Other>(it), batchSize};
+}
+
+template <class T, class Other>
+rusty_iterators::iterator::Spawn<T, Other>::~Spawn()
+{
+    // Cancelling wakes up the worker, if it waits for free space in the ring.
+    // It's joined afterwards, before the shared state is released.
+    if (state)
+        state->ring.cancel();
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Spawn<T, Other>::next() -> std::optional<T>
+{
+    [[unlikely]] if (position == current.size())
+    {
+        auto batch = state->ring.pop();
+
+        [[unlikely]] if (!batch.has_value())
+        {
+            if (state->error)
+                std::rethrow_exception(std::exchange(state->error, nullptr));
+
+            return std::nullopt;
+        }
+        current  = std::move(batch.value());
+        position = 0;
+    }
+
+    if (remaining.has_value() && remaining.value() > 0)
+        remaining = remaining.value() - 1;
+
+    return std::move(current[position++]);
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Spawn<T, Other>::sizeHint() const -> std::optional<size_t>
+{
+    return remaining;
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Spawn<T, Other>::produce(State& state, Other it, size_t batchSize)
+    -> void
+{
+    try
+    {
+        auto batch = Batch{};
+        batch.reserve(batchSize);
+
+        auto nextItem = it.next();
+
+        [[likely]] while (nextItem.has_value())
+        {
+            batch.push_back(std::move(nextItem.value()));
+
+            [[unlikely]] if (batch.size() == batchSize)
+            {
+                if (!state.ring.push(std::move(batch)))
+                    return;
+
+                batch = Batch{};
+                batch.reserve(batchSize);
+            }
+            nextItem = it.next();
+        }
+
+        if (!batch.empty())
+            std::ignore = state.ring.push(std::move(batch));
+    }
+    catch (...)
+    {
+        state.error = std::current_exception();
+    }
+    state.ring.close();
+}
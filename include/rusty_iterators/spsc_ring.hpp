@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace rusty_iterators::concurrency
+{
+constexpr size_t cacheLineSize = 64;
+
+/*
+ * Bounded, lock-free, single producer single consumer ring buffer.
+ *
+ * Both sides can end the exchange: the producer closes the ring when it has
+ * nothing more to send, the consumer cancels it when it is not interested in
+ * more items. Those flags live in the highest bit of the producer and
+ * consumer indices, so a side blocked in `std::atomic::wait` on one of them
+ * is woken up without any additional synchronization.
+ */
+template <class T>
+class SpscRing
+{
+  public:
+    explicit SpscRing(size_t capacity);
+
+    auto cancel() -> void;
+    auto close() -> void;
+
+    [[nodiscard]] auto capacity() const -> size_t { return slots.size(); }
+    [[nodiscard]] auto isCancelled() const -> bool;
+    [[nodiscard]] auto isClosed() const -> bool;
+
+    [[nodiscard]] auto pop() -> std::optional<T>;
+    [[nodiscard]] auto push(T&& item) -> bool;
+    [[nodiscard]] auto tryPop() -> std::optional<T>;
+    [[nodiscard]] auto tryPush(T&& item) -> bool;
+
+    // Batched versions publish many items with a single index update. They
+    // move from the given items and return how many of them were moved.
+    auto popMany(std::vector<T>& out, size_t limit) -> size_t;
+    auto pushMany(std::span<T> items) -> size_t;
+    auto tryPopMany(std::vector<T>& out, size_t limit) -> size_t;
+    auto tryPushMany(std::span<T> items) -> size_t;
+
+  private:
+    static constexpr size_t flag = size_t{1} << (sizeof(size_t) * 8 - 1);
+
+    std::vector<std::optional<T>> slots;
+    size_t mask;
+
+    // Indices are only ever written by one side, so every side keeps a
+    // cached copy of the other index and reloads it only when necessary.
+    alignas(cacheLineSize) std::atomic<size_t> head = 0;
+    size_t cachedTail                               = 0;
+    alignas(cacheLineSize) std::atomic<size_t> tail = 0;
+    size_t cachedHead                               = 0;
+
+    [[nodiscard]] auto available(size_t wanted) -> size_t;
+    [[nodiscard]] auto freeSpace(size_t wanted) -> size_t;
+    [[nodiscard]] auto waitForItems() -> bool;
+    [[nodiscard]] auto waitForSpace() -> bool;
+};
+} // namespace rusty_iterators::concurrency
+
+template <class T>
+rusty_iterators::concurrency::SpscRing<T>::SpscRing(size_t capacity)
+{
+    if (capacity == 0)
+        throw std::length_error{"Ring capacity has to be greater than zero."};
+
+    slots.resize(std::bit_ceil(capacity));
+    mask = slots.size() - 1;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::cancel() -> void
+{
+    head.fetch_or(flag, std::memory_order_release);
+    head.notify_one();
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::close() -> void
+{
+    tail.fetch_or(flag, std::memory_order_release);
+    tail.notify_one();
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::isCancelled() const -> bool
+{
+    return (head.load(std::memory_order_acquire) & flag) != 0;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::isClosed() const -> bool
+{
+    return (tail.load(std::memory_order_acquire) & flag) != 0;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::pop() -> std::optional<T>
+{
+    auto item = tryPop();
+
+    [[likely]] if (item.has_value())
+        return item;
+
+    return waitForItems() ? tryPop() : std::nullopt;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::popMany(std::vector<T>& out, size_t limit) -> size_t
+{
+    auto amount = tryPopMany(out, limit);
+
+    [[likely]] if (amount > 0)
+        return amount;
+
+    return waitForItems() ? tryPopMany(out, limit) : 0;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::push(T&& item) -> bool
+{
+    auto pushed = tryPush(std::move(item));
+
+    while (!pushed && waitForSpace())
+        pushed = tryPush(std::move(item));
+
+    return pushed;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::pushMany(std::span<T> items) -> size_t
+{
+    auto amount = tryPushMany(items);
+
+    while (amount < items.size() && waitForSpace())
+        amount += tryPushMany(items.subspan(amount));
+
+    return amount;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::tryPop() -> std::optional<T>
+{
+    [[unlikely]] if (available(1) == 0)
+        return std::nullopt;
+
+    auto current = head.load(std::memory_order_relaxed);
+    auto& slot   = slots[current & mask];
+    auto item    = std::move(slot);
+    slot.reset();
+
+    head.store(current + 1, std::memory_order_release);
+    head.notify_one();
+
+    return item;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::tryPopMany(std::vector<T>& out, size_t limit)
+    -> size_t
+{
+    auto amount  = std::min(available(limit), limit);
+    auto current = head.load(std::memory_order_relaxed);
+
+    [[unlikely]] if (amount == 0)
+        return 0;
+
+    for (size_t i = 0; i < amount; i++)
+    {
+        auto& slot = slots[(current + i) & mask];
+        out.push_back(std::move(slot.value()));
+        slot.reset();
+    }
+    head.store(current + amount, std::memory_order_release);
+    head.notify_one();
+
+    return amount;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::tryPush(T&& item) -> bool
+{
+    [[unlikely]] if (freeSpace(1) == 0)
+        return false;
+
+    auto current = tail.load(std::memory_order_relaxed);
+    slots[current & mask].emplace(std::move(item));
+
+    tail.store(current + 1, std::memory_order_release);
+    tail.notify_one();
+
+    return true;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::tryPushMany(std::span<T> items) -> size_t
+{
+    auto amount  = std::min(freeSpace(items.size()), items.size());
+    auto current = tail.load(std::memory_order_relaxed);
+
+    [[unlikely]] if (amount == 0)
+        return 0;
+
+    for (size_t i = 0; i < amount; i++)
+        slots[(current + i) & mask].emplace(std::move(items[i]));
+
+    tail.store(current + amount, std::memory_order_release);
+    tail.notify_one();
+
+    return amount;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::available(size_t wanted) -> size_t
+{
+    // The other side's index is reloaded only when the cached one says there
+    // are not enough items, to avoid pulling its cache line on every call.
+    auto index = head.load(std::memory_order_relaxed) & ~flag;
+
+    if (cachedTail - index < wanted)
+        cachedTail = tail.load(std::memory_order_acquire) & ~flag;
+
+    return cachedTail - index;
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::freeSpace(size_t wanted) -> size_t
+{
+    auto index = tail.load(std::memory_order_relaxed) & ~flag;
+
+    if (slots.size() - (index - cachedHead) < wanted)
+        cachedHead = head.load(std::memory_order_acquire) & ~flag;
+
+    return slots.size() - (index - cachedHead);
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::waitForItems() -> bool
+{
+    // Returns false only when the ring is closed and there's nothing left.
+    while (true)
+    {
+        auto observed = tail.load(std::memory_order_acquire);
+
+        if ((observed & ~flag) != (head.load(std::memory_order_relaxed) & ~flag))
+            return true;
+
+        // Closed ring can still contain items pushed before closing.
+        if ((observed & flag) != 0)
+            return false;
+
+        tail.wait(observed, std::memory_order_acquire);
+    }
+}
+
+template <class T>
+auto rusty_iterators::concurrency::SpscRing<T>::waitForSpace() -> bool
+{
+    // Returns false when the consumer cancelled the ring.
+    while (true)
+    {
+        auto observed = head.load(std::memory_order_acquire);
+
+        if ((observed & flag) != 0)
+            return false;
+
+        if ((tail.load(std::memory_order_relaxed) & ~flag) - observed != slots.size())
+            return true;
+
+        head.wait(observed, std::memory_order_acquire);
+    }
+}
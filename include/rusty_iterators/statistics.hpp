@@ -0,0 +1,351 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace rusty_iterators::statistics
+{
+/*
+ * Count, mean, variance and extremes of a stream, updated one value at a
+ * time with the Welford algorithm, which doesn't lose precision the way the
+ * sum of squares does. Partial results, e.g. computed by different threads,
+ * can be combined with `merge`.
+ *
+ * Mean and variance of an empty stream are NaN.
+ */
+class Stats
+{
+  public:
+    auto add(double value) -> void;
+    auto merge(const Stats& other) -> void;
+
+    [[nodiscard]] auto count() const -> size_t { return size; }
+    [[nodiscard]] auto max() const -> std::optional<double>;
+    [[nodiscard]] auto mean() const -> double;
+    [[nodiscard]] auto min() const -> std::optional<double>;
+    [[nodiscard]] auto sampleVariance() const -> double;
+    [[nodiscard]] auto stddev() const -> double { return std::sqrt(variance()); }
+    [[nodiscard]] auto variance() const -> double;
+
+  private:
+    size_t size     = 0;
+    double average  = 0;
+    double m2       = 0;
+    double smallest = std::numeric_limits<double>::infinity();
+    double largest  = -std::numeric_limits<double>::infinity();
+};
+
+/*
+ * Counts of values falling into `bins` equally wide buckets between `low`
+ * and `high`. The last bucket includes `high`. Values outside of the range,
+ * including NaNs, are only counted as underflow or overflow.
+ */
+class Histogram
+{
+  public:
+    Histogram(size_t bins, double low, double high);
+
+    auto add(double value) -> void;
+    auto merge(const Histogram& other) -> void;
+
+    [[nodiscard]] auto counts() const -> std::span<const size_t> { return buckets; }
+    [[nodiscard]] auto lowerEdge(size_t bin) const -> double
+    {
+        return low + static_cast<double>(bin) * width;
+    }
+    [[nodiscard]] auto overflow() const -> size_t { return above; }
+    [[nodiscard]] auto underflow() const -> size_t { return below; }
+
+  private:
+    std::vector<size_t> buckets;
+    double low;
+    double high;
+    double width;
+    size_t below = 0;
+    size_t above = 0;
+};
+
+/*
+ * Merging t-digest by Ted Dunning, a sketch of the distribution answering
+ * quantile queries with bounded memory. Values are clustered into centroids,
+ * which are kept small near both tails, so extreme quantiles are much more
+ * accurate than the median. At most about `compression` centroids are kept,
+ * no matter how many values were added.
+ */
+class TDigest
+{
+  public:
+    explicit TDigest(double compression = 100);
+
+    auto add(double value, double weight = 1) -> void;
+    auto merge(const TDigest& other) -> void;
+
+    [[nodiscard]] auto count() const -> double { return total + buffered; }
+    [[nodiscard]] auto quantile(double q) -> std::optional<double>;
+
+  private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    double compression;
+    size_t bufferLimit;
+    std::vector<Centroid> centroids{};
+    std::vector<Centroid> buffer{};
+    double total    = 0;
+    double buffered = 0;
+    double smallest = std::numeric_limits<double>::infinity();
+    double largest  = -std::numeric_limits<double>::infinity();
+
+    auto compress() -> void;
+    [[nodiscard]] auto quantileLimit(double q) const -> double;
+};
+} // namespace rusty_iterators::statistics
+
+inline auto rusty_iterators::statistics::Stats::add(double value) -> void
+{
+    size += 1;
+
+    auto delta = value - average;
+    average += delta / static_cast<double>(size);
+    m2 += delta * (value - average);
+
+    smallest = std::min(smallest, value);
+    largest  = std::max(largest, value);
+}
+
+inline auto rusty_iterators::statistics::Stats::merge(const Stats& other) -> void
+{
+    [[unlikely]] if (other.size == 0)
+        return;
+
+    [[unlikely]] if (size == 0)
+    {
+        *this = other;
+        return;
+    }
+
+    // Parallel variant of the update by Chan, Golub and LeVeque.
+    auto n     = static_cast<double>(size);
+    auto m     = static_cast<double>(other.size);
+    auto delta = other.average - average;
+
+    average += delta * m / (n + m);
+    m2 += other.m2 + delta * delta * n * m / (n + m);
+    size += other.size;
+
+    smallest = std::min(smallest, other.smallest);
+    largest  = std::max(largest, other.largest);
+}
+
+inline auto rusty_iterators::statistics::Stats::max() const -> std::optional<double>
+{
+    return size == 0 ? std::nullopt : std::make_optional(largest);
+}
+
+inline auto rusty_iterators::statistics::Stats::mean() const -> double
+{
+    return size == 0 ? std::numeric_limits<double>::quiet_NaN() : average;
+}
+
+inline auto rusty_iterators::statistics::Stats::min() const -> std::optional<double>
+{
+    return size == 0 ? std::nullopt : std::make_optional(smallest);
+}
+
+inline auto rusty_iterators::statistics::Stats::sampleVariance() const -> double
+{
+    return size < 2 ? std::numeric_limits<double>::quiet_NaN()
+                    : m2 / static_cast<double>(size - 1);
+}
+
+inline auto rusty_iterators::statistics::Stats::variance() const -> double
+{
+    return size == 0 ? std::numeric_limits<double>::quiet_NaN() : m2 / static_cast<double>(size);
+}
+
+inline rusty_iterators::statistics::Histogram::Histogram(size_t bins, double low, double high)
+    : buckets(bins, 0), low(low), high(high), width((high - low) / static_cast<double>(bins))
+{
+    if (bins == 0)
+        throw std::length_error{"Histogram needs at least one bin."};
+
+    if (!(low < high))
+        throw std::invalid_argument{"Histogram range has to be non empty."};
+}
+
+inline auto rusty_iterators::statistics::Histogram::add(double value) -> void
+{
+    [[unlikely]] if (!(value >= low))
+    {
+        below += 1;
+        return;
+    }
+
+    [[unlikely]] if (value > high)
+    {
+        above += 1;
+        return;
+    }
+
+    // Rounding can put the values close to `high` one bin too far.
+    auto bin = static_cast<size_t>((value - low) / width);
+    buckets[std::min(bin, buckets.size() - 1)] += 1;
+}
+
+inline auto rusty_iterators::statistics::Histogram::merge(const Histogram& other) -> void
+{
+    if (buckets.size() != other.buckets.size() || low != other.low || high != other.high)
+        throw std::invalid_argument{"Only histograms with the same bins can be merged."};
+
+    for (size_t i = 0; i < buckets.size(); i++)
+        buckets[i] += other.buckets[i];
+
+    below += other.below;
+    above += other.above;
+}
+
+inline rusty_iterators::statistics::TDigest::TDigest(double compression)
+    : compression(compression), bufferLimit(static_cast<size_t>(5 * compression))
+{
+    if (!(compression >= 10))
+        throw std::invalid_argument{"T-digest compression has to be at least 10."};
+
+    // Sorting a bigger buffer less often is cheaper than merging every value.
+    buffer.reserve(bufferLimit);
+}
+
+inline auto rusty_iterators::statistics::TDigest::add(double value, double weight) -> void
+{
+    [[unlikely]] if (std::isnan(value))
+        return;
+
+    buffer.push_back(Centroid{value, weight});
+    buffered += weight;
+
+    smallest = std::min(smallest, value);
+    largest  = std::max(largest, value);
+
+    [[unlikely]] if (buffer.size() >= bufferLimit)
+        compress();
+}
+
+inline auto rusty_iterators::statistics::TDigest::merge(const TDigest& other) -> void
+{
+    // Adding values can reallocate the buffer we are iterating over.
+    [[unlikely]] if (&other == this)
+    {
+        auto copy = other;
+        return merge(copy);
+    }
+
+    for (const auto& centroid : other.centroids)
+        add(centroid.mean, centroid.weight);
+
+    for (const auto& centroid : other.buffer)
+        add(centroid.mean, centroid.weight);
+
+    smallest = std::min(smallest, other.smallest);
+    largest  = std::max(largest, other.largest);
+}
+
+inline auto rusty_iterators::statistics::TDigest::quantile(double q) -> std::optional<double>
+{
+    if (!(q >= 0 && q <= 1))
+        throw std::invalid_argument{"Quantile has to be between 0 and 1."};
+
+    compress();
+
+    [[unlikely]] if (centroids.empty())
+        return std::nullopt;
+
+    [[unlikely]] if (centroids.size() == 1)
+        return centroids.front().mean;
+
+    // Every centroid is assumed to be spread evenly around its mean, so we
+    // interpolate between the centers of the neighbours, and between the
+    // extremes and the outermost centroids.
+    auto target = q * total;
+    auto first  = centroids.front();
+    auto last   = centroids.back();
+
+    if (target < first.weight / 2)
+        return smallest + (first.mean - smallest) * target / (first.weight / 2);
+
+    if (target > total - last.weight / 2)
+        return largest - (largest - last.mean) * (total - target) / (last.weight / 2);
+
+    auto center = first.weight / 2;
+
+    for (size_t i = 0; i + 1 < centroids.size(); i++)
+    {
+        auto gap = (centroids[i].weight + centroids[i + 1].weight) / 2;
+
+        if (target <= center + gap)
+        {
+            auto fraction = (target - center) / gap;
+            return centroids[i].mean + fraction * (centroids[i + 1].mean - centroids[i].mean);
+        }
+        center += gap;
+    }
+    return last.mean;
+}
+
+inline auto rusty_iterators::statistics::TDigest::compress() -> void
+{
+    [[likely]] if (buffer.empty())
+        return;
+
+    buffer.insert(buffer.end(), centroids.begin(), centroids.end());
+    std::ranges::sort(buffer, {}, &Centroid::mean);
+
+    total += buffered;
+    buffered = 0;
+    centroids.clear();
+
+    // Neighbouring centroids are merged as long as the result stays within
+    // the size allowed by the scale function at its position.
+    auto current = buffer.front();
+    auto before  = 0.0;
+    auto limit   = quantileLimit(0);
+
+    for (size_t i = 1; i < buffer.size(); i++)
+    {
+        auto& next = buffer[i];
+
+        if ((before + current.weight + next.weight) / total <= limit)
+        {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            continue;
+        }
+        before += current.weight;
+        centroids.push_back(current);
+
+        current = next;
+        limit   = quantileLimit(before / total);
+    }
+    centroids.push_back(current);
+    buffer.clear();
+}
+
+inline auto rusty_iterators::statistics::TDigest::quantileLimit(double q) const -> double
+{
+    // Scale function k(q) = compression / 2pi * asin(2q - 1), a centroid
+    // starting at `q` may grow until k increases by one.
+    auto scale = compression / (2 * std::numbers::pi);
+    auto k     = scale * std::asin(2 * q - 1) + 1;
+
+    if (k >= compression / 4)
+        return 1;
+
+    return (std::sin(k / scale) + 1) / 2;
+}
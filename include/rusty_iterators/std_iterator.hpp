@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+
+namespace rusty_iterators::iterator
+{
+/*
+ * Single pass adapter exposing our iterators through the standard iterator
+ * protocol. It allows using them in range-for loops and `std::ranges`
+ * algorithms, with `std::default_sentinel` marking the end.
+ */
+template <class T, class Other>
+class StdIterator
+{
+  public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type       = T;
+    using difference_type  = std::ptrdiff_t;
+
+    StdIterator() = default;
+    explicit StdIterator(Other& it) : it(&it), item(it.next()) {}
+
+    [[nodiscard]] auto operator*() const -> const T& { return *item; }
+    auto operator++() -> StdIterator&;
+    auto operator++(int) -> void { ++*this; }
+
+    [[nodiscard]] friend auto operator==(const StdIterator& self, std::default_sentinel_t) -> bool
+    {
+        return !self.item.has_value();
+    }
+
+  private:
+    Other* it             = nullptr;
+    std::optional<T> item = std::nullopt;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+auto rusty_iterators::iterator::StdIterator<T, Other>::operator++() -> StdIterator&
+{
+    item = it->next();
+    return *this;
+}
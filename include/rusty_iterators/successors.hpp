@@ -0,0 +1,48 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "interface.hpp"
+
+#include <optional>
+#include <utility>
+
+namespace rusty_iterators::iterator
+{
+using concepts::SuccessorFunctor;
+using interface::IterInterface;
+
+// Yields `first` and then every item computed from the previous one, until
+// the callable returns an empty optional.
+template <class T, class Functor>
+    requires SuccessorFunctor<T, Functor>
+class Successors : public IterInterface<T, Successors<T, Functor>>
+{
+  public:
+    Successors(std::optional<T> first, Functor&& f)
+        : nextItem(std::move(first)), func(std::forward<Functor>(f))
+    {}
+
+    auto next() -> std::optional<T>
+    {
+        [[unlikely]] if (!nextItem.has_value())
+            return std::nullopt;
+
+        auto successor = func(std::as_const(nextItem.value()));
+        return std::exchange(nextItem, std::move(successor));
+    }
+
+    // Same as for lazy file reading, we can't know when the sequence ends.
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t> { return 0; }
+
+  private:
+    std::optional<T> nextItem;
+    Functor func;
+};
+
+template <class T, class Functor>
+    requires SuccessorFunctor<T, Functor>
+[[nodiscard]] auto successors(T first, Functor&& f) -> Successors<T, Functor>
+{
+    return Successors<T, Functor>{std::move(first), std::forward<Functor>(f)};
+}
+} // namespace rusty_iterators::iterator
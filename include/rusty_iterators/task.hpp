@@ -0,0 +1,171 @@
+#pragma once
+
+#include "frame_pool.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace rusty_iterators::async
+{
+using coroutine::FramePool;
+
+template <class T>
+class Task;
+
+/*
+ * Shared part of every task promise. Tasks are lazy, they start when awaited
+ * and resume their awaiter directly (symmetric transfer) when finished, so
+ * long chains of awaits don't grow the stack.
+ */
+class TaskPromiseBase
+{
+  public:
+    struct FinalAwaiter
+    {
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+        auto await_resume() const noexcept -> void {}
+
+        template <class Promise>
+        auto await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+            -> std::coroutine_handle<>
+        {
+            auto continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+    };
+
+    [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+    [[nodiscard]] auto final_suspend() const noexcept -> FinalAwaiter { return {}; }
+    auto unhandled_exception() -> void { error = std::current_exception(); }
+
+    [[nodiscard]] static auto operator new(size_t size) -> void*
+    {
+        return FramePool::allocate(size);
+    }
+    static auto operator delete(void* ptr, size_t size) noexcept -> void
+    {
+        FramePool::deallocate(ptr, size);
+    }
+
+    std::coroutine_handle<> continuation = nullptr;
+    std::exception_ptr error             = nullptr;
+
+  protected:
+    auto rethrowIfFailed() -> void
+    {
+        [[unlikely]] if (error)
+            std::rethrow_exception(std::exchange(error, nullptr));
+    }
+};
+
+template <class T>
+class TaskPromise : public TaskPromiseBase
+{
+  public:
+    [[nodiscard]] auto get_return_object() -> Task<T>;
+
+    template <class U = T>
+    auto return_value(U&& value) -> void
+    {
+        result.emplace(std::forward<U>(value));
+    }
+
+    [[nodiscard]] auto value() -> T
+    {
+        rethrowIfFailed();
+        return std::move(result.value());
+    }
+
+  private:
+    std::optional<T> result = std::nullopt;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+  public:
+    [[nodiscard]] auto get_return_object() -> Task<void>;
+
+    auto return_void() -> void {}
+    auto value() -> void { rethrowIfFailed(); }
+};
+
+/*
+ * Lazy coroutine producing a single value of type `T`, which can be
+ * `co_await`ed from other coroutines or driven by an `EventLoop`.
+ */
+template <class T = void>
+class Task
+{
+  public:
+    using promise_type = TaskPromise<T>;
+    using Handle       = std::coroutine_handle<promise_type>;
+
+    explicit Task(Handle handle) : handle(handle) {}
+    ~Task();
+
+    Task(const Task&)                    = delete;
+    auto operator=(const Task&) -> Task& = delete;
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    auto operator=(Task&& other) noexcept -> Task&;
+
+    [[nodiscard]] auto operator co_await() const noexcept;
+
+  private:
+    Handle handle;
+};
+} // namespace rusty_iterators::async
+
+template <class T>
+auto rusty_iterators::async::TaskPromise<T>::get_return_object() -> Task<T>
+{
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline auto rusty_iterators::async::TaskPromise<void>::get_return_object() -> Task<void>
+{
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+template <class T>
+rusty_iterators::async::Task<T>::~Task()
+{
+    if (handle)
+        handle.destroy();
+}
+
+template <class T>
+auto rusty_iterators::async::Task<T>::operator=(Task&& other) noexcept -> Task&
+{
+    if (this != &other)
+    {
+        if (handle)
+            handle.destroy();
+
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+template <class T>
+auto rusty_iterators::async::Task<T>::operator co_await() const noexcept
+{
+    struct Awaiter
+    {
+        Handle handle;
+
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return handle.done(); }
+
+        auto await_suspend(std::coroutine_handle<> awaiting) const noexcept
+            -> std::coroutine_handle<>
+        {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        auto await_resume() const -> T { return handle.promise().value(); }
+    };
+    return Awaiter{handle};
+}
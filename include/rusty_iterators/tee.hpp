@@ -0,0 +1,190 @@
+#pragma once
+
+#include "interface.fwd.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::iterator
+{
+using interface::IterInterface;
+
+template <class T, class Other>
+class Tee;
+
+/*
+ * State shared by all the consumers of a single upstream iterator. Only the
+ * items which were already pulled, but not yet seen by the slowest consumer
+ * are kept in the buffer. Positions are absolute indices of the upstream.
+ */
+template <class T, class Other>
+class TeeState
+{
+  public:
+    TeeState(Other&& it, size_t consumers, size_t limit)
+        : it(std::forward<Other>(it)), positions(consumers, 0), alive(consumers, true),
+          limit(limit)
+    {}
+
+  private:
+    friend class Tee<T, Other>;
+
+    Other it;
+    std::deque<T> buffer{};
+    size_t offset = 0;
+    std::vector<size_t> positions;
+    std::vector<bool> alive;
+    size_t limit;
+    bool exhausted = false;
+
+    [[nodiscard]] auto isNeededByOthers(size_t consumer, size_t position) const -> bool;
+    auto release(size_t consumer) -> void;
+    auto trim() -> void;
+};
+
+/*
+ * One of the iterators returned by `tee`. Consumers can be advanced in any
+ * order, but they share the upstream, so they have to be used from a single
+ * thread.
+ *
+ * When a consumer runs ahead of the others by more than the buffer limit
+ * allows, `next` throws `std::length_error` instead of growing the buffer.
+ * Dropping a consumer stops buffering items for it.
+ */
+template <class T, class Other>
+class Tee : public IterInterface<T, Tee<T, Other>>
+{
+  public:
+    Tee(std::shared_ptr<TeeState<T, Other>> state, size_t consumer)
+        : state(std::move(state)), consumer(consumer)
+    {}
+    ~Tee() override;
+
+    Tee(const Tee&)                    = delete;
+    auto operator=(const Tee&) -> Tee& = delete;
+    Tee(Tee&&) noexcept                = default;
+    auto operator=(Tee&&) -> Tee&      = delete;
+
+    auto next() -> std::optional<T>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::shared_ptr<TeeState<T, Other>> state;
+    size_t consumer;
+};
+} // namespace rusty_iterators::iterator
+
+template <class T, class Other>
+auto rusty_iterators::iterator::TeeState<T, Other>::isNeededByOthers(size_t consumer,
+                                                                     size_t position) const
+    -> bool
+{
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        if (i != consumer && alive[i] && positions[i] <= position)
+            return true;
+    }
+    return false;
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::TeeState<T, Other>::release(size_t consumer) -> void
+{
+    alive[consumer] = false;
+    trim();
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::TeeState<T, Other>::trim() -> void
+{
+    auto slowest = std::numeric_limits<size_t>::max();
+
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        if (alive[i])
+            slowest = std::min(slowest, positions[i]);
+    }
+
+    while (!buffer.empty() && offset < slowest)
+    {
+        buffer.pop_front();
+        offset += 1;
+    }
+}
+
+template <class T, class Other>
+rusty_iterators::iterator::Tee<T, Other>::~Tee()
+{
+    if (state)
+        state->release(consumer);
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Tee<T, Other>::next() -> std::optional<T>
+{
+    auto& shared   = *state;
+    auto& position = shared.positions[consumer];
+
+    // Item was already pulled by a faster consumer.
+    [[likely]] if (position < shared.offset + shared.buffer.size())
+    {
+        auto idx = position - shared.offset;
+        position += 1;
+
+        // The slowest consumer takes the item out of the buffer, so items
+        // are copied only for the consumers which are still behind.
+        [[likely]] if (idx == 0 && !shared.isNeededByOthers(consumer, position - 1))
+        {
+            auto item = std::move(shared.buffer.front());
+            shared.buffer.pop_front();
+            shared.offset += 1;
+
+            return item;
+        }
+        return shared.buffer[idx];
+    }
+
+    [[unlikely]] if (shared.exhausted)
+        return std::nullopt;
+
+    // Checked before pulling the item, so it's not lost when we throw.
+    auto isNeeded = shared.isNeededByOthers(consumer, position);
+
+    [[unlikely]] if (isNeeded && shared.buffer.size() == shared.limit)
+        throw std::length_error{"Tee consumer got too far ahead of the others."};
+
+    auto item = shared.it.next();
+
+    [[unlikely]] if (!item.has_value())
+    {
+        shared.exhausted = true;
+        return std::nullopt;
+    }
+
+    [[likely]] if (isNeeded)
+        shared.buffer.push_back(item.value());
+    else
+        shared.offset += 1;
+
+    position += 1;
+    return item;
+}
+
+template <class T, class Other>
+auto rusty_iterators::iterator::Tee<T, Other>::sizeHint() const -> std::optional<size_t>
+{
+    auto itSize = state->exhausted ? std::optional<size_t>{0} : state->it.sizeHint();
+
+    if (!itSize.has_value())
+        return std::nullopt;
+
+    auto buffered = state->offset + state->buffer.size() - state->positions[consumer];
+
+    return itSize.value() + buffered;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace rusty_iterators::concurrency
+{
+/*
+ * Fixed size pool of worker threads executing submitted tasks in FIFO order.
+ * Tasks which were not started yet, when the pool is destroyed, are dropped,
+ * so owners have to wait for the results they depend on first.
+ */
+class ThreadPool
+{
+  public:
+    using Task = std::move_only_function<void()>;
+
+    explicit ThreadPool(size_t threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)                    = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+    ThreadPool(ThreadPool&&)                         = delete;
+    auto operator=(ThreadPool&&) -> ThreadPool&      = delete;
+
+    [[nodiscard]] auto size() const -> size_t { return workers.size(); }
+    auto submit(Task task) -> void;
+
+    // Zero threads means one thread per available core.
+    [[nodiscard]] static auto resolve(size_t threads) -> size_t;
+
+  private:
+    std::mutex mutex{};
+    std::condition_variable_any available{};
+    std::deque<Task> queue{};
+    std::vector<std::jthread> workers{};
+
+    auto work(const std::stop_token& token) -> void;
+};
+} // namespace rusty_iterators::concurrency
+
+inline rusty_iterators::concurrency::ThreadPool::ThreadPool(size_t threads)
+{
+    threads = resolve(threads);
+    workers.reserve(threads);
+
+    for (size_t i = 0; i < threads; i++)
+        workers.emplace_back([this](const std::stop_token& token) { work(token); });
+}
+
+inline rusty_iterators::concurrency::ThreadPool::~ThreadPool()
+{
+    for (auto& worker : workers)
+        worker.request_stop();
+
+    workers.clear();
+}
+
+inline auto rusty_iterators::concurrency::ThreadPool::submit(Task task) -> void
+{
+    {
+        auto lock = std::lock_guard{mutex};
+        queue.push_back(std::move(task));
+    }
+    available.notify_one();
+}
+
+inline auto rusty_iterators::concurrency::ThreadPool::resolve(size_t threads) -> size_t
+{
+    [[likely]] if (threads > 0)
+        return threads;
+
+    return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+inline auto rusty_iterators::concurrency::ThreadPool::work(const std::stop_token& token) -> void
+{
+    while (true)
+    {
+        auto task = Task{};
+        {
+            auto lock = std::unique_lock{mutex};
+
+            if (!available.wait(lock, token, [this] { return !queue.empty(); }))
+                return;
+
+            task = std::move(queue.front());
+            queue.pop_front();
+        }
+        task();
+    }
+}
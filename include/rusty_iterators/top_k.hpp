@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rusty_iterators::statistics
+{
+/*
+ * Keeps the `k` best items seen so far, where `Compare` orders the keys from
+ * the best to the worst, e.g. `std::greater<>` keeps the largest ones. The
+ * worst kept item sits on top of a heap, so every new item is compared with
+ * it once and most are rejected without touching the heap at all.
+ *
+ * Ties are resolved in favor of the item seen first. Partial results, e.g.
+ * computed by different threads, can be combined with `merge`, which treats
+ * the other items as if they came after ours.
+ */
+template <class T, class Key = std::identity, class Compare = std::greater<>>
+class TopK
+{
+  public:
+    explicit TopK(size_t k, Key key = Key{}, Compare compare = Compare{})
+        : k(k), key(std::move(key)), compare(std::move(compare))
+    {
+        heap.reserve(k);
+    }
+
+    auto add(T item) -> void;
+    auto merge(const TopK& other) -> void;
+
+    // Kept items from the best to the worst.
+    [[nodiscard]] auto sorted() const -> std::vector<T>;
+
+  private:
+    struct Entry
+    {
+        size_t order;
+        T item;
+    };
+
+    size_t k;
+    [[no_unique_address]] Key key;
+    [[no_unique_address]] Compare compare;
+    std::vector<Entry> heap{};
+    size_t seen = 0;
+
+    auto offer(size_t order, T&& item) -> void;
+    [[nodiscard]] auto isBetter(const Entry& first, const Entry& second) const -> bool;
+};
+} // namespace rusty_iterators::statistics
+
+template <class T, class Key, class Compare>
+auto rusty_iterators::statistics::TopK<T, Key, Compare>::add(T item) -> void
+{
+    offer(seen++, std::move(item));
+}
+
+template <class T, class Key, class Compare>
+auto rusty_iterators::statistics::TopK<T, Key, Compare>::merge(const TopK& other) -> void
+{
+    auto entries = other.heap;
+
+    for (auto& entry : entries)
+        offer(seen + entry.order, std::move(entry.item));
+
+    seen += other.seen;
+}
+
+template <class T, class Key, class Compare>
+auto rusty_iterators::statistics::TopK<T, Key, Compare>::sorted() const -> std::vector<T>
+{
+    auto entries = heap;
+    std::ranges::sort_heap(entries, [this](const auto& a, const auto& b) {
+        return isBetter(a, b);
+    });
+
+    auto result = std::vector<T>{};
+    result.reserve(entries.size());
+
+    for (auto& entry : entries)
+        result.push_back(std::move(entry.item));
+
+    return result;
+}
+
+template <class T, class Key, class Compare>
+auto rusty_iterators::statistics::TopK<T, Key, Compare>::offer(size_t order, T&& item) -> void
+{
+    auto better = [this](const auto& a, const auto& b) { return isBetter(a, b); };
+
+    [[unlikely]] if (heap.size() < k)
+    {
+        heap.push_back(Entry{order, std::move(item)});
+        std::ranges::push_heap(heap, better);
+        return;
+    }
+
+    auto entry = Entry{order, std::move(item)};
+
+    // Heap ordered by `better` keeps the worst item in front.
+    [[likely]] if (k == 0 || !isBetter(entry, heap.front()))
+        return;
+
+    std::ranges::pop_heap(heap, better);
+    heap.back() = std::move(entry);
+    std::ranges::push_heap(heap, better);
+}
+
+template <class T, class Key, class Compare>
+auto rusty_iterators::statistics::TopK<T, Key, Compare>::isBetter(const Entry& first,
+                                                                  const Entry& second) const
+    -> bool
+{
+    using K = std::remove_cvref_t<std::unwrap_reference_t<
+        std::remove_cvref_t<std::invoke_result_t<const Key&, const T&>>>>;
+
+    // Keys of the iterators over containers are reference wrappers, which
+    // don't forward the comparison operators.
+    const auto& a = std::invoke(key, first.item);
+    const auto& b = std::invoke(key, second.item);
+
+    if (compare(static_cast<const K&>(a), static_cast<const K&>(b)))
+        return true;
+
+    if (compare(static_cast<const K&>(b), static_cast<const K&>(a)))
+        return false;
+
+    return first.order < second.order;
+}
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <optional>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace rusty_iterators::iterator
 {
@@ -26,6 +28,39 @@ class Zip : public IterInterface<std::tuple<T, R>, Zip<T, R, First, Second>>
     First first;
     Second second;
 };
+
+/*
+ * Zips three or more iterators into flat tuples, instead of the nested ones
+ * of chained two way zips. Ends with the shortest iterator, the ones after
+ * it are not advanced for the last, incomplete tuple.
+ */
+template <class... Its>
+class MultiZip : public IterInterface<std::tuple<typename Its::Type...>, MultiZip<Its...>>
+{
+    using Tout = std::tuple<typename Its::Type...>;
+
+  public:
+    explicit MultiZip(Its&&... its) : its(std::forward<Its>(its)...) {}
+
+    auto advanceBy(size_t amount) -> void;
+    auto next() -> std::optional<Tout>;
+    [[nodiscard]] auto sizeHint() const -> std::optional<size_t>;
+
+  private:
+    std::tuple<Its...> its;
+};
+
+// Column vectors of every field of tuple like items, either as they are or
+// unwrapped into values.
+template <class R, class Indices = std::make_index_sequence<std::tuple_size_v<R>>>
+struct Columns;
+
+template <class R, size_t... I>
+struct Columns<R, std::index_sequence<I...>>
+{
+    using Items  = std::tuple<std::vector<std::tuple_element_t<I, R>>...>;
+    using Values = std::tuple<std::vector<Unwrapped<std::tuple_element_t<I, R>>>...>;
+};
 } // namespace rusty_iterators::iterator
 
 template <class T, class R, class First, class Second>
@@ -66,3 +101,46 @@ auto rusty_iterators::iterator::Zip<T, R, First, Second>::sizeHint() const -> st
     }
     return secondSize;
 }
+
+template <class... Its>
+auto rusty_iterators::iterator::MultiZip<Its...>::advanceBy(size_t amount) -> void
+{
+    std::apply([amount](auto&... it) { (it.advanceBy(amount), ...); }, its);
+}
+
+template <class... Its>
+auto rusty_iterators::iterator::MultiZip<Its...>::next() -> std::optional<Tout>
+{
+    return [this]<size_t... I>(std::index_sequence<I...>) -> std::optional<Tout> {
+        auto items = std::tuple<std::optional<typename Its::Type>...>{};
+
+        // Short circuits on the first exhausted iterator.
+        bool complete = ((std::get<I>(items) = std::get<I>(its).next(),
+                          std::get<I>(items).has_value()) &&
+                         ...);
+
+        if (!complete)
+            return std::nullopt;
+
+        return Tout{std::move(std::get<I>(items).value())...};
+    }(std::index_sequence_for<Its...>{});
+}
+
+template <class... Its>
+auto rusty_iterators::iterator::MultiZip<Its...>::sizeHint() const -> std::optional<size_t>
+{
+    // Same as `Zip`, the shortest finite iterator decides.
+    auto size = std::optional<size_t>{};
+
+    std::apply(
+        [&size](const auto&... it) {
+            auto shorten = [&size](std::optional<size_t> other) {
+                if (other.has_value())
+                    size = std::min(size.value_or(other.value()), other.value());
+            };
+            (shorten(it.sizeHint()), ...);
+        },
+        its);
+
+    return size;
+}
@@ -0,0 +1,127 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+
+#include <rusty_iterators/async_file_iterator.hpp>
+#include <rusty_iterators/event_loop.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <string>
+
+using ::rusty_iterators::async::EventLoop;
+using ::rusty_iterators::async::Task;
+using ::rusty_iterators::iterator::AsyncFileIterator;
+using ::testing::ElementsAreArray;
+
+namespace
+{
+// Pipe with all of the data already written and the writing end closed.
+class FilledPipe
+{
+  public:
+    explicit FilledPipe(const std::string& data)
+    {
+        if (pipe(fds.data()) == -1)
+            throw std::runtime_error{"Could not create a pipe."};
+
+        auto _ = write(fds[1], data.data(), data.size());
+        close(fds[1]);
+    }
+    ~FilledPipe() { close(fds[0]); }
+
+    FilledPipe(const FilledPipe&)                    = delete;
+    auto operator=(const FilledPipe&) -> FilledPipe& = delete;
+    FilledPipe(FilledPipe&&)                         = delete;
+    auto operator=(FilledPipe&&) -> FilledPipe&      = delete;
+
+    [[nodiscard]] auto fd() const -> int { return fds[0]; }
+
+  private:
+    std::array<int, 2> fds{};
+};
+} // namespace
+
+TEST(TestAsyncIterInterface, CollectLines)
+{
+    auto loop   = EventLoop{};
+    auto pipe   = FilledPipe{"a\nbc\n\nd"};
+    auto result = loop.runUntilComplete(AsyncFileIterator{loop, pipe.fd()}.collect());
+
+    EXPECT_THAT(result, ElementsAreArray({"a", "bc", "", "d"}));
+}
+
+TEST(TestAsyncIterInterface, CustomDelimiter)
+{
+    auto loop   = EventLoop{};
+    auto pipe   = FilledPipe{"1,2,3,"};
+    auto result = loop.runUntilComplete(AsyncFileIterator{loop, pipe.fd(), ','}.collect());
+
+    EXPECT_THAT(result, ElementsAreArray({"1", "2", "3"}));
+}
+
+TEST(TestAsyncIterInterface, MapFilterFold)
+{
+    auto loop = EventLoop{};
+    auto pipe = FilledPipe{"1\n2\n3\n4\n5\n"};
+    auto it   = AsyncFileIterator{loop, pipe.fd()}
+                  .map([](auto x) { return std::stoi(x); })
+                  .filter([](auto x) { return x % 2 == 1; });
+
+    auto result = loop.runUntilComplete(it.fold(0, [](auto acc, auto x) { return acc + x; }));
+
+    ASSERT_EQ(result, 9);
+}
+
+TEST(TestAsyncIterInterface, TakeStopsEarly)
+{
+    auto loop   = EventLoop{};
+    auto pipe   = FilledPipe{"a\nb\nc\n"};
+    auto result = loop.runUntilComplete(AsyncFileIterator{loop, pipe.fd()}.take(2).collect());
+
+    EXPECT_THAT(result, ElementsAreArray({"a", "b"}));
+}
+
+TEST(TestAsyncIterInterface, ChunksKeepTheRemainder)
+{
+    auto loop   = EventLoop{};
+    auto pipe   = FilledPipe{"1\n2\n3\n4\n5\n"};
+    auto it     = AsyncFileIterator{loop, pipe.fd()}.chunks(2).map([](auto x) { return x.size(); });
+    auto result = loop.runUntilComplete(it.collect());
+
+    EXPECT_THAT(result, ElementsAreArray({2, 2, 1}));
+}
+
+TEST(TestAsyncIterInterface, ForEach)
+{
+    auto loop  = EventLoop{};
+    auto pipe  = FilledPipe{"ab\ncde\n"};
+    auto total = size_t{0};
+
+    loop.runUntilComplete(
+        AsyncFileIterator{loop, pipe.fd()}.forEach([&total](auto x) { total += x.size(); }));
+
+    ASSERT_EQ(total, 5);
+}
+
+TEST(TestAsyncIterInterface, LongLinesSpanningManyReads)
+{
+    auto loop   = EventLoop{};
+    auto line   = std::string(10'000, 'x');
+    auto pipe   = FilledPipe{line + "\n" + line};
+    auto result = loop.runUntilComplete(AsyncFileIterator{loop, pipe.fd()}.collect());
+
+    EXPECT_THAT(result, ElementsAreArray({line, line}));
+}
+
+TEST(TestAsyncIterInterface, ChunkSizeZeroThrows)
+{
+    auto loop = EventLoop{};
+    auto pipe = FilledPipe{""};
+
+    EXPECT_THROW(AsyncFileIterator(loop, pipe.fd()).chunks(0), std::length_error);
+}
+
+#endif
@@ -2,8 +2,11 @@
 #include <gtest/gtest.h>
 
 #include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
 
+using ::rusty_iterators::iterator::concat;
 using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
 using ::testing::ElementsAreArray;
 
 TEST(TestChainIterator, TestCollect)
@@ -55,3 +58,64 @@ TEST(TestChainIterator, TestIteratorCount)
 
     ASSERT_EQ(it.count(), 5);
 }
+
+TEST(TestChainIterator, TestChainAllMixedIterators)
+{
+    auto v1    = std::vector{1, 2};
+    auto v2    = std::vector{3};
+    auto unref = [](auto x) { return x.get(); };
+
+    auto it = range(0, 1).chainAll(range(5, 5), LazyIterator{v1}.map(unref), range(7, 9),
+                                   LazyIterator{v2}.map(unref));
+
+    EXPECT_EQ(it.sizeHint(), 6);
+    EXPECT_EQ(it.next(), 0);
+    EXPECT_THAT(it.collect(), ElementsAreArray({1, 2, 7, 8, 3}));
+}
+
+TEST(TestChainIterator, TestConcatRuntimeList)
+{
+    auto groups = std::vector<std::vector<int>>{{1, 2}, {}, {3, 4, 5}, {6}};
+    auto its    = std::vector<LazyIterator<std::vector<int>>>{};
+
+    for (auto& group : groups)
+        its.emplace_back(group);
+
+    auto it = concat(std::move(its));
+
+    EXPECT_EQ(it.sizeHint(), 6);
+    EXPECT_EQ(it.fold(0, [](auto acc, auto x) { return acc + x.get(); }), 21);
+}
+
+TEST(TestChainIterator, TestConcatAdvanceByAcrossSegments)
+{
+    auto it = range(0, 3).chainAll(range(10, 10), range(20, 25), range(30, 32));
+
+    it.advanceBy(5);
+
+    EXPECT_EQ(it.sizeHint(), 5);
+    EXPECT_EQ(it.next(), 22);
+
+    it.advanceBy(3);
+
+    EXPECT_EQ(it.next(), 31);
+    EXPECT_EQ(it.next(), std::nullopt);
+
+    auto filtered = range(0, 4).filter([](auto x) { return x % 2 == 0; });
+    auto other    = range(4, 10).filter([](auto x) { return x % 2 == 0; });
+    auto mixed    = std::move(filtered).chainAll(std::move(other));
+
+    mixed.advanceBy(3);
+
+    EXPECT_THAT(mixed.collect(), ElementsAreArray({6, 8}));
+}
+
+TEST(TestChainIterator, TestConcatCountAndInfiniteSizeHint)
+{
+    auto v1 = std::vector{1, 2};
+
+    EXPECT_EQ(range(0, 3).chainAll(range(0, 4), range(0, 0)).count(), 7);
+    EXPECT_EQ(range(0, 3).chainAll(LazyIterator{v1}.map([](auto x) { return x.get(); }).cycle())
+                  .sizeHint(),
+              std::nullopt);
+}
@@ -0,0 +1,137 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/channel.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ::rusty_iterators::concurrency::MpmcChannel;
+using ::rusty_iterators::concurrency::SpscChannel;
+using ::testing::ElementsAreArray;
+
+TEST(TestSpscChannel, ReceiveUntilClosed)
+{
+    auto channel = SpscChannel<int>{4};
+
+    ASSERT_TRUE(channel.send(1));
+    ASSERT_TRUE(channel.send(2));
+    channel.close();
+
+    ASSERT_EQ(channel.receive(), 1);
+    ASSERT_EQ(channel.receive(), 2);
+    ASSERT_EQ(channel.receive(), std::nullopt);
+}
+
+TEST(TestSpscChannel, SendFailsAfterCancel)
+{
+    auto channel = SpscChannel<int>{1};
+
+    ASSERT_TRUE(channel.send(1));
+    channel.cancel();
+
+    ASSERT_FALSE(channel.send(2));
+}
+
+TEST(TestMpmcChannel, ZeroCapacityThrows)
+{
+    EXPECT_THROW(MpmcChannel<int>{0}, std::length_error);
+}
+
+TEST(TestMpmcChannel, ReceiveUntilClosed)
+{
+    auto channel = MpmcChannel<int>{4};
+
+    ASSERT_TRUE(channel.send(1));
+    ASSERT_TRUE(channel.send(2));
+    channel.close();
+
+    ASSERT_EQ(channel.receive(), 1);
+    ASSERT_EQ(channel.receive(), 2);
+    ASSERT_EQ(channel.receive(), std::nullopt);
+}
+
+TEST(TestMpmcChannel, SendFailsAfterClose)
+{
+    auto channel = MpmcChannel<int>{4};
+
+    channel.close();
+
+    ASSERT_FALSE(channel.send(1));
+}
+
+TEST(TestMpmcChannel, BatchesAreLimitedByCapacity)
+{
+    auto channel = MpmcChannel<int>{4};
+    auto items   = std::vector{1, 2, 3, 4, 5};
+    auto out     = std::vector<int>{};
+
+    ASSERT_EQ(channel.trySendBatch(items), 4);
+    ASSERT_EQ(channel.tryReceiveBatch(out, 2), 2);
+    ASSERT_EQ(channel.trySendBatch(std::span{items}.subspan(4)), 1);
+    ASSERT_EQ(channel.tryReceiveBatch(out, 10), 3);
+
+    EXPECT_THAT(out, ElementsAreArray(items));
+}
+
+TEST(TestMpmcChannel, SingleSlotChannelKeepsItemsApart)
+{
+    auto channel = MpmcChannel<int>{1};
+
+    ASSERT_TRUE(channel.send(1));
+    ASSERT_TRUE(channel.send(2));
+    ASSERT_EQ(channel.trySendBatch(std::span<int>{}), 0);
+    ASSERT_EQ(channel.receive(), 1);
+    ASSERT_EQ(channel.receive(), 2);
+    ASSERT_EQ(channel.tryReceive(), std::nullopt);
+}
+
+TEST(TestMpmcChannel, ManySendersAndReceivers)
+{
+    constexpr int senders   = 4;
+    constexpr int receivers = 3;
+    constexpr int perSender = 5000;
+
+    auto channel  = MpmcChannel<int>{16};
+    auto received = std::vector<std::vector<int>>(receivers);
+
+    {
+        auto consumers = std::vector<std::jthread>{};
+
+        for (auto& out : received)
+            consumers.emplace_back([&channel, &out] {
+                while (channel.receiveBatch(out, 8) > 0)
+                    ;
+            });
+
+        {
+            auto producers = std::vector<std::jthread>{};
+
+            for (int s = 0; s < senders; s++)
+                producers.emplace_back([&channel, s] {
+                    auto items = std::vector<int>{};
+
+                    for (int i = 0; i < perSender; i++)
+                        items.push_back(s * perSender + i);
+
+                    for (size_t i = 0; i < items.size(); i += 10)
+                        ASSERT_EQ(channel.sendBatch(std::span{items}.subspan(i, 10)), 10);
+                });
+        }
+        channel.close();
+    }
+
+    auto all = std::vector<int>{};
+
+    for (auto& out : received)
+        all.insert(all.end(), out.begin(), out.end());
+
+    std::ranges::sort(all);
+
+    ASSERT_EQ(all.size(), senders * perSender);
+
+    for (int i = 0; i < senders * perSender; i++)
+        ASSERT_EQ(all[i], i);
+}
@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/channel.hpp>
+#include <rusty_iterators/channel_iterator.hpp>
+#include <rusty_iterators/iterator.hpp>
+
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+
+using ::rusty_iterators::concurrency::MpmcChannel;
+using ::rusty_iterators::concurrency::SpscChannel;
+using ::rusty_iterators::iterator::ChannelIterator;
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestChannelIterator, CollectUntilClosed)
+{
+    auto channel = SpscChannel<int>{8};
+
+    ASSERT_TRUE(channel.send(1));
+    ASSERT_TRUE(channel.send(2));
+    ASSERT_TRUE(channel.send(3));
+    channel.close();
+
+    auto it = ChannelIterator{channel, 2};
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{1, 2, 3}));
+}
+
+TEST(TestChannelIterator, SizeHintIsUnknown)
+{
+    auto channel = MpmcChannel<int>{8};
+    auto it      = ChannelIterator{channel};
+
+    ASSERT_EQ(it.sizeHint(), 0);
+}
+
+TEST(TestChannelIterator, ZeroBatchSizeThrows)
+{
+    auto channel = MpmcChannel<int>{8};
+
+    EXPECT_THROW(ChannelIterator(channel, 0), std::length_error);
+}
+
+TEST(TestChannelIterator, SendToDoesNotCloseChannel)
+{
+    auto channel = MpmcChannel<int>{8};
+    auto vec     = std::vector{1, 2, 3};
+
+    ASSERT_EQ(LazyIterator{vec}.sendTo(channel, 2), 3);
+    ASSERT_FALSE(channel.isClosed());
+
+    channel.close();
+
+    EXPECT_THAT(ChannelIterator{channel}.collect(), ElementsAreArray(std::array{1, 2, 3}));
+}
+
+TEST(TestChannelIterator, SendToStopsWhenChannelIsClosed)
+{
+    auto channel = MpmcChannel<int>{8};
+
+    channel.close();
+
+    ASSERT_EQ(LazyIterator{std::views::iota(0)}.sendTo(channel), 0);
+}
+
+TEST(TestChannelIterator, PipelineAcrossThreads)
+{
+    auto channel = SpscChannel<int>{16};
+
+    auto producer = std::jthread{[&channel] {
+        LazyIterator{std::views::iota(0, 10000)}
+            .map([](auto x) { return x * 2; })
+            .sendTo(channel, 32);
+        channel.close();
+    }};
+
+    auto sum = ChannelIterator{channel}.filter([](auto x) { return x % 3 == 0; }).sum();
+
+    ASSERT_EQ(sum, 33336666);
+}
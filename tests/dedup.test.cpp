@@ -0,0 +1,42 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestDedupIterator, TestCollapseConsecutiveDuplicates)
+{
+    auto vec = std::vector{1, 1, 2, 3, 3, 3, 1, 4, 4};
+
+    EXPECT_THAT(LazyIterator{vec}.dedup().collect(), ElementsAreArray({1, 2, 3, 1, 4}));
+}
+
+TEST(TestDedupIterator, TestDedupStrings)
+{
+    auto vec    = std::vector<std::string>{"a", "a", "b", "a"};
+    auto result = LazyIterator{vec}.dedup().collect();
+    auto owned  = std::vector<std::string>(result.begin(), result.end());
+
+    EXPECT_THAT(owned, ElementsAreArray({"a", "b", "a"}));
+}
+
+TEST(TestDedupIterator, TestDedupByKeepsFirstOfRun)
+{
+    auto result = range(0, 10).dedupBy([](auto x) { return x / 3; }).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({0, 3, 6, 9}));
+}
+
+TEST(TestDedupIterator, TestDedupOfEmptyIterator)
+{
+    auto vec = std::vector<int>{};
+    auto it  = LazyIterator{vec}.dedup();
+
+    EXPECT_EQ(it.next(), std::nullopt);
+    EXPECT_EQ(it.sizeHint(), 0);
+}
@@ -0,0 +1,165 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+
+#include <rusty_iterators/async_file_iterator.hpp>
+#include <rusty_iterators/event_loop.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ::rusty_iterators::async::EventLoop;
+using ::rusty_iterators::async::Task;
+using ::rusty_iterators::iterator::AsyncFileIterator;
+using ::testing::ElementsAreArray;
+
+namespace
+{
+auto makePipe() -> std::array<int, 2>
+{
+    auto fds = std::array<int, 2>{};
+
+    if (pipe(fds.data()) == -1)
+        throw std::runtime_error{"Could not create a pipe."};
+
+    return fds;
+}
+
+auto sumLines(EventLoop& loop, int fd, int& result) -> Task<void>
+{
+    result = co_await AsyncFileIterator{loop, fd}
+                 .map([](auto x) { return std::stoi(x); })
+                 .fold(0, [](auto acc, auto x) { return acc + x; });
+}
+
+auto failing() -> Task<int>
+{
+    throw std::runtime_error{"Task failed."};
+    co_return 0;
+}
+
+auto nested(int depth) -> Task<int>
+{
+    if (depth == 0)
+        co_return 0;
+
+    co_return 1 + co_await nested(depth - 1);
+}
+} // namespace
+
+TEST(TestEventLoop, RunUntilCompleteReturnsValue)
+{
+    auto loop = EventLoop{};
+
+    ASSERT_EQ(loop.runUntilComplete(nested(1000)), 1000);
+}
+
+TEST(TestEventLoop, ExceptionsArePropagated)
+{
+    auto loop = EventLoop{};
+
+    EXPECT_THROW(loop.runUntilComplete(failing()), std::runtime_error);
+}
+
+TEST(TestEventLoop, WaitsForSlowWriter)
+{
+    auto loop   = EventLoop{};
+    auto fds    = makePipe();
+    auto writer = std::thread{[fd = fds[1]] {
+        for (const auto* chunk : {"1\n2", "\n3\n", "4"})
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+            auto _ = write(fd, chunk, std::char_traits<char>::length(chunk));
+        }
+        close(fd);
+    }};
+
+    auto result = loop.runUntilComplete(AsyncFileIterator{loop, fds[0]}.collect());
+
+    writer.join();
+    close(fds[0]);
+
+    EXPECT_THAT(result, ElementsAreArray({"1", "2", "3", "4"}));
+}
+
+TEST(TestEventLoop, MultiplexManyStreams)
+{
+    constexpr int streams = 100;
+
+    auto loop    = EventLoop{};
+    auto pipes   = std::vector<std::array<int, 2>>{};
+    auto results = std::vector<int>(streams, 0);
+
+    for (int i = 0; i < streams; i++)
+    {
+        pipes.push_back(makePipe());
+        loop.spawn(sumLines(loop, pipes.back()[0], results.at(i)));
+    }
+
+    // All of the readers are suspended before anything gets written.
+    auto writer = std::thread{[&pipes] {
+        for (size_t i = 0; i < pipes.size(); i++)
+        {
+            auto data = std::to_string(i) + "\n" + std::to_string(i) + "\n";
+            auto _    = write(pipes.at(i)[1], data.data(), data.size());
+            close(pipes.at(i)[1]);
+        }
+    }};
+
+    loop.run();
+    writer.join();
+
+    for (int i = 0; i < streams; i++)
+    {
+        close(pipes.at(i)[0]);
+        ASSERT_EQ(results.at(i), 2 * i);
+    }
+}
+
+TEST(TestEventLoop, SecondWaiterOnDescriptorFails)
+{
+    auto loop   = EventLoop{};
+    auto fds    = makePipe();
+    auto first  = 0;
+    auto second = 0;
+
+    loop.spawn(sumLines(loop, fds[0], first));
+    loop.spawn(sumLines(loop, fds[0], second));
+
+    auto writer = std::thread{[fd = fds[1]] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        auto _ = write(fd, "1\n2\n", 4);
+        close(fd);
+    }};
+
+    EXPECT_THROW(loop.run(), std::logic_error);
+
+    writer.join();
+    close(fds[0]);
+
+    EXPECT_EQ(first, 3);
+    EXPECT_EQ(second, 0);
+}
+
+TEST(TestEventLoop, UnfinishedTasksAreDestroyed)
+{
+    auto fds = makePipe();
+    auto res = 0;
+
+    {
+        auto loop = EventLoop{};
+        loop.spawn(sumLines(loop, fds[0], res));
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#endif
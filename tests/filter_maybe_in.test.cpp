@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+#include <utility>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::IsSupersetOf;
+
+TEST(TestFilterMaybeIn, TestKeepsAllPresentKeys)
+{
+    auto keys  = std::vector{3, 7, 11};
+    auto bloom = LazyIterator{keys}.collectBloom();
+
+    auto result = range(0, 1'000).filterMaybeIn(bloom, [](auto x) { return x; }).collect();
+
+    // False positives are allowed, but they are rare with so few keys.
+    EXPECT_THAT(result, IsSupersetOf({3, 7, 11}));
+    EXPECT_LT(result.size(), 20);
+}
+
+TEST(TestFilterMaybeIn, TestFilterByKey)
+{
+    using Order = std::pair<std::string, int>;
+
+    auto customers = std::vector<std::string>{"ann", "bob"};
+    auto orders    = std::vector<Order>{{"ann", 1}, {"cid", 2}, {"bob", 3}, {"dan", 4}};
+    auto bloom     = LazyIterator{customers}.collectBloom();
+
+    auto result = LazyIterator{orders}
+                      .filterMaybeIn(bloom, [](const auto& x) { return x.get().first; })
+                      .map([](auto x) { return x.get().second; })
+                      .collect();
+
+    EXPECT_THAT(result, IsSupersetOf({1, 3}));
+}
+
+TEST(TestFilterMaybeIn, TestEmptyFilterRejectsEverything)
+{
+    auto empty = std::vector<int>{};
+    auto bloom = LazyIterator{empty}.collectBloom();
+
+    EXPECT_EQ(range(0, 100).filterMaybeIn(bloom, [](auto x) { return x; }).count(), 0);
+}
+
+TEST(TestFilterMaybeIn, TestSizeHint)
+{
+    auto bloom = range(0, 10).collectBloom();
+    auto it    = range(0, 100).filterMaybeIn(bloom, [](auto x) { return x; });
+
+    EXPECT_EQ(it.sizeHint(), 100);
+}
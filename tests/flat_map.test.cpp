@@ -0,0 +1,156 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <list>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestFlatMapIterator, TestFlattenNestedContainers)
+{
+    auto vec = std::vector<std::vector<int>>{{1, 2}, {}, {3}, {4, 5, 6}};
+    auto it  = LazyIterator{vec}.flatten();
+
+    EXPECT_EQ(it.next(), 1);
+    EXPECT_EQ(it.next(), 2);
+    EXPECT_EQ(it.next(), 3);
+    EXPECT_EQ(it.sizeHint(), 0);
+    EXPECT_EQ(it.next(), 4);
+    EXPECT_EQ(it.sizeHint(), 2);
+    EXPECT_THAT(it.collect(), ElementsAreArray({5, 6}));
+}
+
+TEST(TestFlatMapIterator, TestFlattenIterators)
+{
+    auto it = range(0, 4).map([](auto x) { return range(0, x); }).flatten();
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({0, 0, 1, 0, 1, 2}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapMovesOutOfOwnedRanges)
+{
+    auto lines = std::vector<std::string>{"a bb", "", "ccc d e"};
+
+    auto tokens = LazyIterator{lines}
+                      .flatMap([](const auto& line) {
+                          auto stream = std::istringstream{line.get()};
+                          auto result = std::vector<std::string>{};
+
+                          for (auto token = std::string{}; stream >> token;)
+                              result.push_back(token);
+
+                          return result;
+                      })
+                      .collect();
+
+    EXPECT_THAT(tokens, ElementsAreArray({"a", "bb", "ccc", "d", "e"}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapSurvivesMoveMidIteration)
+{
+    auto it = range(1, 4).flatMap([](auto x) { return std::string(x, 'a' + x); });
+
+    EXPECT_EQ(it.next(), 'b');
+
+    auto moved = std::move(it);
+
+    EXPECT_THAT(moved.collect(), ElementsAreArray({'c', 'c', 'd', 'd', 'd'}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapBorrowsReferences)
+{
+    auto groups = std::vector<std::list<int>>{{1, 2}, {3}};
+    auto it = LazyIterator{groups}.flatMap([](auto x) -> const std::list<int>& { return x.get(); });
+
+    auto first = it.next().value();
+
+    EXPECT_EQ(&first.get(), &groups[0].front());
+    EXPECT_THAT(it.map([](auto x) { return x.get(); }).collect(), ElementsAreArray({2, 3}));
+}
+
+struct Record
+{
+    std::vector<int> values;
+    std::string name;
+};
+
+TEST(TestFlatMapIterator, TestFlatMapKeepsItemsBorrowedFrom)
+{
+    auto records = range(1, 4).map([](auto x) { return Record{std::vector<int>(x, x), {}}; });
+    auto result  = std::move(records)
+                      .flatMap([](const Record& r) -> const std::vector<int>& { return r.values; })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 2, 3, 3, 3}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapBorrowedFromSurvivesMove)
+{
+    auto names = range(0, 2).map([](auto x) { return Record{{}, std::string(3, 'a' + x)}; });
+    auto it    = std::move(names).flatMap([](const Record& r) { return std::cref(r.name); });
+
+    EXPECT_EQ(it.next(), 'a');
+
+    auto moved = std::move(it);
+
+    EXPECT_THAT(moved.collect(), ElementsAreArray({'a', 'a', 'b', 'b', 'b'}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapKeepsItemsViewedInto)
+{
+    auto lines = range(0, 3).map([](auto x) { return std::string(40, 'a' + x); });
+    auto it    = std::move(lines).flatMap([](const std::string& s) { return std::string_view{s}; });
+    auto count = 0;
+
+    for (auto item = it.next(); item.has_value(); item = it.next())
+        count += item == 'a' + count / 40;
+
+    EXPECT_EQ(count, 120);
+
+    auto spans = range(1, 4)
+                     .map([](auto x) { return Record{std::vector<int>(x, x), {}}; })
+                     .flatMap([](const Record& r) { return std::span{r.values}; });
+
+    EXPECT_THAT(spans.collect(), ElementsAreArray({1, 2, 2, 3, 3, 3}));
+}
+
+TEST(TestFlatMapIterator, TestFlatMapCopiesItemsOfBorrowingIterators)
+{
+    auto it = range(1, 4)
+                  .map([](auto x) { return Record{std::vector<int>(x, x), {}}; })
+                  .flatMap([](const Record& r) { return LazyIterator{r.values}; });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({1, 2, 2, 3, 3, 3}));
+}
+
+TEST(TestFlatMapIterator, TestFoldIsForwardedToInnerSequences)
+{
+    auto calls = 0;
+    auto it    = range(0, 5).flatMap([](auto x) { return range(0, x); });
+
+    std::ignore = it.next();
+
+    auto sum = it.fold(0, [&calls](auto acc, auto x) {
+        calls += 1;
+        return acc + x;
+    });
+
+    EXPECT_EQ(sum, 1 + 3 + 6);
+    EXPECT_EQ(calls, 9);
+    EXPECT_EQ(range(0, 5).flatMap([](auto x) { return range(0, x); }).count(), 10);
+}
+
+TEST(TestFlatMapIterator, TestSizeHint)
+{
+    auto vec = std::vector<std::vector<int>>{{1, 2}};
+
+    EXPECT_EQ(LazyIterator{vec}.flatten().sizeHint(), 0);
+    EXPECT_EQ(LazyIterator{vec}.cycle().flatten().sizeHint(), std::nullopt);
+}
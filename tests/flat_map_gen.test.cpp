@@ -0,0 +1,89 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/generator.hpp>
+#include <rusty_iterators/iterator.hpp>
+
+#include <string>
+
+using ::rusty_iterators::iterator::Generator;
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestFlatMapGenIterator, YieldManyItemsPerInput)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.flatMapGen([](auto input) -> Generator<int> {
+        while (auto x = input.next())
+        {
+            for (int i = 0; i < x.value(); i++)
+                co_yield x.value();
+        }
+    });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({1, 2, 2, 3, 3, 3}));
+}
+
+TEST(TestFlatMapGenIterator, KeepStateBetweenElements)
+{
+    // Length prefixed frames: every frame starts with the amount of bytes.
+    auto bytes = std::vector<char>{3, 'a', 'b', 'c', 0, 2, 'd', 'e'};
+    auto it    = LazyIterator{bytes}.flatMapGen([](auto input) -> Generator<std::string> {
+        while (auto size = input.next())
+        {
+            auto frame = std::string{};
+
+            for (int i = 0; i < size.value(); i++)
+                frame.push_back(input.next().value());
+
+            co_yield std::move(frame);
+        }
+    });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({"abc", "", "de"}));
+}
+
+TEST(TestFlatMapGenIterator, SkipInputs)
+{
+    auto vec = std::vector{1, 2, 3, 4, 5, 6};
+    auto it  = LazyIterator{vec}.flatMapGen([](auto input) -> Generator<int> {
+        auto sum = 0;
+
+        while (auto x = input.next())
+        {
+            sum += x.value();
+
+            if (x.value() % 3 == 0)
+                co_yield std::exchange(sum, 0);
+        }
+    });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({6, 15}));
+}
+
+TEST(TestFlatMapGenIterator, CapturedStateSurvivesMove)
+{
+    auto vec    = std::vector{1, 2, 3};
+    auto offset = 10;
+    auto it     = LazyIterator{vec}.flatMapGen([offset](auto input) -> Generator<int> {
+        while (auto x = input.next())
+            co_yield x.value() + offset;
+    });
+
+    ASSERT_EQ(it.next(), 11);
+
+    auto mapped = std::move(it).map([](auto x) { return x * 2; });
+
+    EXPECT_THAT(mapped.collect(), ElementsAreArray({24, 26}));
+}
+
+TEST(TestFlatMapGenIterator, SizeHint)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto gen = [](auto input) -> Generator<int> { co_yield 1; };
+    auto it  = LazyIterator{vec}.flatMapGen(gen);
+    auto inf = LazyIterator{vec}.cycle().flatMapGen(gen);
+
+    ASSERT_EQ(it.sizeHint(), 0);
+    ASSERT_EQ(inf.sizeHint(), std::nullopt);
+}
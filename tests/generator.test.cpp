@@ -0,0 +1,105 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/generator.hpp>
+
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::Generator;
+using ::testing::ElementsAreArray;
+
+namespace
+{
+auto countTo(int n) -> Generator<int>
+{
+    for (int i = 1; i <= n; i++)
+        co_yield i;
+}
+
+auto fibonacci() -> Generator<size_t>
+{
+    size_t a = 0;
+    size_t b = 1;
+
+    while (true)
+    {
+        co_yield a;
+        a = std::exchange(b, a + b);
+    }
+}
+
+auto throwAfter(int n) -> Generator<int>
+{
+    for (int i = 0; i < n; i++)
+        co_yield i;
+
+    throw std::runtime_error{"Generator failed."};
+}
+} // namespace
+
+TEST(TestGenerator, NextResumesCoroutine)
+{
+    auto it = countTo(2);
+
+    ASSERT_EQ(it.next(), 1);
+    ASSERT_EQ(it.next(), 2);
+    ASSERT_EQ(it.next(), std::nullopt);
+    ASSERT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestGenerator, CollectFiniteGenerator)
+{
+    EXPECT_THAT(countTo(4).collect(), ElementsAreArray({1, 2, 3, 4}));
+}
+
+TEST(TestGenerator, AdaptersOverInfiniteGenerator)
+{
+    auto it = fibonacci().filter([](auto x) { return x % 2 == 0; }).take(4);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({0, 2, 8, 34}));
+}
+
+TEST(TestGenerator, SizeHintIsUnknown)
+{
+    ASSERT_EQ(countTo(3).sizeHint(), 0);
+}
+
+TEST(TestGenerator, ExceptionsArePropagated)
+{
+    auto it = throwAfter(1);
+
+    ASSERT_EQ(it.next(), 0);
+    EXPECT_THROW(it.next(), std::runtime_error);
+}
+
+TEST(TestGenerator, MovedGeneratorKeepsState)
+{
+    auto it = countTo(3);
+    it.next();
+
+    auto moved = std::move(it);
+
+    ASSERT_EQ(it.next(), std::nullopt);
+    EXPECT_THAT(moved.collect(), ElementsAreArray({2, 3}));
+}
+
+TEST(TestGenerator, YieldNonTrivialValues)
+{
+    auto gen = [](int n) -> Generator<std::string> {
+        for (int i = 0; i < n; i++)
+            co_yield std::string(i, 'a');
+    };
+
+    EXPECT_THAT(gen(3).collect(), ElementsAreArray({"", "a", "aa"}));
+}
+
+TEST(TestGenerator, FramesAreRecycled)
+{
+    auto total = 0;
+
+    for (int i = 0; i < 1000; i++)
+        total += countTo(3).sum();
+
+    ASSERT_EQ(total, 6000);
+}
@@ -0,0 +1,144 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/flat_hash_map.hpp>
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+
+using ::rusty_iterators::containers::FlatHashMap;
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::Pair;
+using ::testing::UnorderedElementsAreArray;
+
+TEST(TestGroupBy, TestCounts)
+{
+    auto vec    = std::vector<std::string>{"a", "bb", "cc", "d", "eee", "f"};
+    auto result = LazyIterator{vec}.groupBy([](const auto& x) { return x.get().size(); }).counts();
+
+    EXPECT_THAT(result, UnorderedElementsAreArray({Pair(1, 3), Pair(2, 2), Pair(3, 1)}));
+}
+
+TEST(TestGroupBy, TestSumBy)
+{
+    auto result = range(0, 10).groupBy([](auto x) { return x % 3; }).sumBy([](auto x) {
+        return x * 10;
+    });
+
+    EXPECT_THAT(result, UnorderedElementsAreArray({Pair(0, 180), Pair(1, 120), Pair(2, 150)}));
+}
+
+TEST(TestGroupBy, TestFoldBy)
+{
+    auto vec    = std::vector<std::string>{"apple", "avocado", "banana", "blueberry", "cherry"};
+    auto result = LazyIterator{vec}
+                      .groupBy([](const auto& x) { return x.get()[0]; })
+                      .foldBy(std::string{}, [](std::string acc, const std::string& x) {
+                          return acc.empty() ? x : acc + "," + x;
+                      });
+
+    EXPECT_THAT(result, UnorderedElementsAreArray({Pair('a', "apple,avocado"),
+                                                   Pair('b', "banana,blueberry"),
+                                                   Pair('c', "cherry")}));
+}
+
+TEST(TestGroupBy, TestCollectGroups)
+{
+    auto result = range(0, 7).groupBy([](auto x) { return x % 2 == 0; }).collectGroups();
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_THAT(*result.find(true), UnorderedElementsAreArray({0, 2, 4, 6}));
+    EXPECT_THAT(*result.find(false), UnorderedElementsAreArray({1, 3, 5}));
+}
+
+TEST(TestGroupBy, TestGroupByOfEmptyIterator)
+{
+    auto vec = std::vector<int>{};
+
+    EXPECT_TRUE(LazyIterator{vec}.groupBy([](auto x) { return x; }).counts().empty());
+}
+
+TEST(TestGroupBy, TestManyGroups)
+{
+    auto result = range(0, 100'000).groupBy([](auto x) { return x / 2; }).counts();
+
+    ASSERT_EQ(result.size(), 50'000);
+
+    for (const auto& [key, count] : result)
+        ASSERT_EQ(count, 2);
+
+    EXPECT_EQ(result.find(100'000), nullptr);
+}
+
+TEST(TestGroupBy, TestCustomHasher)
+{
+    // Even the worst hasher only makes the probes longer.
+    auto constant = [](int) -> uint64_t { return 7; };
+    auto result   = range(0, 100).groupBy([](auto x) { return x % 10; }, constant).counts();
+
+    ASSERT_EQ(result.size(), 10);
+    EXPECT_EQ(*result.find(3), 10);
+}
+
+TEST(TestGroupBy, TestKeysDifferingInHighBits)
+{
+    // The identity hash of these keys has all of its low bits equal.
+    auto key    = [](auto x) { return static_cast<uint64_t>(x % 500) << 40; };
+    auto result = range(0, 1000).groupBy(key).counts();
+
+    ASSERT_EQ(result.size(), 500);
+
+    for (const auto& [key, count] : result)
+        ASSERT_EQ(count, 2);
+}
+
+TEST(TestFlatHashMap, TestInsertAndFind)
+{
+    auto map = FlatHashMap<std::string, int>{};
+
+    EXPECT_TRUE(map.tryEmplace("one", 1).second);
+    EXPECT_FALSE(map.tryEmplace("one", 2).second);
+    map["two"] += 2;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(*map.find("one"), 1);
+    EXPECT_EQ(*map.find("two"), 2);
+    EXPECT_FALSE(map.contains("three"));
+}
+
+TEST(TestFlatHashMap, TestIntoEntries)
+{
+    auto map = FlatHashMap<int, int>{4};
+
+    for (int i = 0; i < 100; i++)
+        map[i % 5] += i;
+
+    auto entries = map.intoEntries();
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_THAT(entries, UnorderedElementsAreArray({Pair(0, 950), Pair(1, 970), Pair(2, 990),
+                                                    Pair(3, 1010), Pair(4, 1030)}));
+}
+
+TEST(TestFlatHashMap, TestCopyAndMove)
+{
+    auto map = FlatHashMap<std::string, std::string>{};
+
+    for (int i = 0; i < 50; i++)
+        map[std::to_string(i)] = std::string(i, 'x');
+
+    auto copy  = map;
+    auto moved = std::move(map);
+    copy["0"]  = "changed";
+
+    ASSERT_EQ(copy.size(), 50);
+    ASSERT_EQ(moved.size(), 50);
+    EXPECT_EQ(*copy.find("0"), "changed");
+    EXPECT_EQ(*moved.find("0"), "");
+    EXPECT_EQ(*moved.find("49"), std::string(49, 'x'));
+
+    moved = copy;
+    EXPECT_EQ(*moved.find("0"), "changed");
+}
@@ -3,6 +3,16 @@
 
 #include <rusty_iterators/iterator.hpp>
 
+#include <array>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <ranges>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 using ::rusty_iterators::iterator::LazyIterator;
 using ::testing::ElementsAreArray;
 
@@ -395,3 +405,321 @@ TEST(TestIterator, TestProductOnMapIterator)
 
     ASSERT_EQ(it.product(), 2 * 4 * 6 * 8);
 }
+
+TEST(TestIterator, TestEqOnByteBuffers)
+{
+    auto v1 = std::vector<uint8_t>(1000, 7);
+    auto v2 = std::vector<uint8_t>(1000, 7);
+
+    ASSERT_TRUE(LazyIterator{v1}.eq(LazyIterator{v2}));
+
+    v2.back() = 8;
+
+    ASSERT_FALSE(LazyIterator{v1}.eq(LazyIterator{v2}));
+    ASSERT_TRUE(LazyIterator{v1}.ne(LazyIterator{v2}));
+}
+
+TEST(TestIterator, TestEqComparesCommonPrefix)
+{
+    auto v1 = std::vector{1, 2, 3};
+    auto v2 = std::vector{1, 2, 3, 4};
+
+    ASSERT_TRUE(LazyIterator{v1}.eq(LazyIterator{v2}));
+    ASSERT_EQ(LazyIterator{v1}.eq(LazyIterator{v2}),
+              LazyIterator{v1}.map([](auto x) { return x.get(); }).eq(LazyIterator{v2}));
+}
+
+TEST(TestIterator, TestEqOnEmptyBuffers)
+{
+    auto empty = std::vector<int>{};
+    auto full  = std::vector{1, 2, 3};
+
+    ASSERT_TRUE(LazyIterator{empty}.eq(LazyIterator{empty}));
+    ASSERT_TRUE(LazyIterator{empty}.eq(LazyIterator{full}));
+    ASSERT_TRUE(LazyIterator{full}.eq(LazyIterator{empty}));
+}
+
+TEST(TestIterator, TestEqAfterPartialConsumption)
+{
+    auto v1 = std::vector{0, 1, 2, 3};
+    auto v2 = std::vector{1, 2, 3};
+    auto it = LazyIterator{v1};
+
+    it.next();
+
+    ASSERT_TRUE(it.eq(LazyIterator{v2}));
+    ASSERT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestIterator, TestPositionOfInts)
+{
+    auto vec = std::vector{5, 6, 7, 8};
+    auto it  = LazyIterator{vec};
+
+    ASSERT_EQ(it.positionOf(7), 2);
+    ASSERT_EQ(it.next(), 8);
+}
+
+TEST(TestIterator, TestPositionOfBytes)
+{
+    auto vec = std::string(500, 'a');
+    vec[321] = 'b';
+
+    ASSERT_EQ(LazyIterator{vec}.positionOf('b'), 321);
+    ASSERT_EQ(LazyIterator{vec}.positionOf('c'), std::nullopt);
+}
+
+TEST(TestIterator, TestPositionOfStrings)
+{
+    auto vec = std::vector<std::string>{"a", "bc", "d"};
+
+    ASSERT_EQ(LazyIterator{vec}.positionOf("d"), 2);
+}
+
+TEST(TestIterator, TestPositionOfDepletesIteratorWhenNotFound)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec};
+
+    ASSERT_EQ(it.positionOf(4), std::nullopt);
+    ASSERT_EQ(it.sizeHint(), 0);
+}
+
+TEST(TestIterator, TestPositionOfOnAdapter)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.map([](auto x) { return x * 2; });
+
+    ASSERT_EQ(it.positionOf(4), 1);
+}
+
+TEST(TestIterator, TestAnyAllOnBytesStopAtFirstHit)
+{
+    auto vec   = std::vector<uint8_t>(200, 1);
+    vec[150]   = 0;
+    auto calls = size_t{0};
+
+    ASSERT_TRUE(LazyIterator{vec}.any([&calls](auto x) {
+        calls++;
+        return x == 0;
+    }));
+    ASSERT_EQ(calls, 151);
+
+    calls = 0;
+    ASSERT_FALSE(LazyIterator{vec}.all([&calls](auto x) {
+        calls++;
+        return x == 1;
+    }));
+    ASSERT_EQ(calls, 151);
+}
+
+TEST(TestIterator, TestPositionOnBytesConsumesUpToMatch)
+{
+    auto vec   = std::vector<uint8_t>(130, 0);
+    vec[100]   = 1;
+    vec[101]   = 2;
+    auto it    = LazyIterator{vec};
+    auto calls = size_t{0};
+
+    ASSERT_EQ(it.position([&calls](auto x) {
+        calls++;
+        return x != 0;
+    }), 100);
+    ASSERT_EQ(calls, 101);
+    ASSERT_EQ(it.next(), 2);
+}
+
+TEST(TestIterator, TestContainsOnBytesConsumesUpToMatch)
+{
+    auto vec = std::vector<uint8_t>(130, 0);
+    vec[100] = 1;
+    vec[101] = 2;
+    auto it  = LazyIterator{vec};
+
+    ASSERT_TRUE(it.contains(1));
+    ASSERT_EQ(it.next(), 2);
+    ASSERT_FALSE(it.contains(1));
+    ASSERT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestIterator, TestAllEqualStopsAtFirstMismatch)
+{
+    auto vec = std::vector<uint8_t>(200, 1);
+    vec[150] = 0;
+    vec[151] = 2;
+    auto it  = LazyIterator{vec};
+
+    ASSERT_FALSE(it.allEqual(1));
+    ASSERT_EQ(it.next(), 2);
+    ASSERT_FALSE(it.allEqual(2));
+    ASSERT_EQ(it.sizeHint(), 47);
+
+    vec.assign(200, 1);
+    auto empty = std::vector<uint8_t>{};
+
+    ASSERT_TRUE(LazyIterator{vec}.allEqual(1));
+    ASSERT_TRUE(LazyIterator{empty}.allEqual(1));
+}
+
+TEST(TestIterator, TestContainsAndAllEqualOnLists)
+{
+    auto list = std::list{3, 3, 4};
+
+    ASSERT_TRUE(LazyIterator{list}.contains(4));
+    ASSERT_FALSE(LazyIterator{list}.contains(5));
+    ASSERT_FALSE(LazyIterator{list}.allEqual(3));
+    ASSERT_TRUE(LazyIterator{list}.take(2).allEqual(3));
+}
+
+TEST(TestIterator, TestConstContainer)
+{
+    const auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THAT(LazyIterator{vec}.collect(), ElementsAreArray({1, 2, 3}));
+}
+
+TEST(TestIterator, TestListSizeHintAndAdvanceBy)
+{
+    auto list = std::list{1, 2, 3, 4};
+    auto it   = LazyIterator{list};
+
+    ASSERT_EQ(it.sizeHint(), 4);
+
+    it.advanceBy(2);
+
+    ASSERT_EQ(it.sizeHint(), 2);
+    EXPECT_THAT(it.collect(), ElementsAreArray({3, 4}));
+}
+
+TEST(TestIterator, TestMapContainer)
+{
+    auto map = std::map<int, std::string>{{1, "a"}, {2, "b"}};
+    auto it  = LazyIterator{map}.map([](auto x) { return x.get().second; });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({"a", "b"}));
+}
+
+TEST(TestIterator, TestViewProducingValues)
+{
+    auto view = std::views::iota(0, 5) | std::views::transform([](auto x) { return x * x; });
+    auto it   = LazyIterator{view};
+
+    ASSERT_EQ(it.sizeHint(), 5);
+    EXPECT_THAT(it.collect(), ElementsAreArray({0, 1, 4, 9, 16}));
+}
+
+TEST(TestIterator, TestFilterViewHasUnknownSize)
+{
+    auto vec  = std::vector{1, 2, 3, 4};
+    auto view = vec | std::views::filter([](auto x) { return x > 2; });
+    auto it   = LazyIterator{view};
+
+    ASSERT_EQ(it.sizeHint(), 0);
+    ASSERT_EQ(it.sum(), 7);
+}
+
+TEST(TestIterator, TestBorrowedTemporaryRange)
+{
+    auto it = LazyIterator{std::views::iota(0, 100)};
+
+    it.advanceBy(90);
+
+    ASSERT_EQ(it.sizeHint(), 10);
+    ASSERT_EQ(it.next(), 90);
+}
+
+TEST(TestIterator, TestUnboundedRangeIsInfinite)
+{
+    auto it = LazyIterator{std::views::iota(0)};
+
+    ASSERT_EQ(it.sizeHint(), std::nullopt);
+    ASSERT_EQ(it.nth(1000), 1000);
+}
+
+TEST(TestIterator, TestStringView)
+{
+    auto it = LazyIterator{std::string_view{"abcd"}};
+
+    ASSERT_EQ(it.positionOf('c'), 2);
+}
+
+TEST(TestIterator, TestCollectIntoReusesCapacity)
+{
+    auto vec    = std::vector{1, 2, 3, 4};
+    auto buffer = std::vector<int>{};
+    auto unref  = [](auto x) { return x.get(); };
+
+    LazyIterator{vec}.map(unref).collectInto(buffer);
+
+    auto* data = buffer.data();
+    buffer.clear();
+
+    EXPECT_THAT(LazyIterator{vec}.map(unref).take(2).collectInto(buffer), ElementsAreArray({1, 2}));
+    EXPECT_EQ(buffer.data(), data);
+
+    LazyIterator{vec}.map(unref).collectInto(buffer);
+
+    EXPECT_THAT(buffer, ElementsAreArray({1, 2, 1, 2, 3, 4}));
+}
+
+TEST(TestIterator, TestCollectIntoSpan)
+{
+    auto vec    = std::vector{1, 2, 3, 4, 5};
+    auto buffer = std::array<int, 3>{};
+    auto it     = LazyIterator{vec};
+
+    EXPECT_EQ(it.collectInto(std::span<int>{buffer}), 3);
+    EXPECT_THAT(buffer, ElementsAreArray({1, 2, 3}));
+    EXPECT_EQ(it.collectInto(std::span<int>{buffer}), 2);
+    EXPECT_THAT(buffer, ElementsAreArray({4, 5, 3}));
+    EXPECT_EQ(it.collectInto(std::span<int>{buffer}), 0);
+
+    auto filtered = LazyIterator{vec}.filter([](auto x) { return x % 2 == 1; });
+
+    EXPECT_EQ(filtered.collectInto(std::span<int>{buffer}.first(2)), 2);
+    EXPECT_THAT(buffer, ElementsAreArray({1, 3, 3}));
+    EXPECT_EQ(filtered.next(), 5);
+}
+
+TEST(TestIterator, TestCollectOtherContainers)
+{
+    auto vec   = std::vector{3, 1, 2, 3, 1};
+    auto unref = [](auto x) { return x.get(); };
+
+    EXPECT_THAT(LazyIterator{vec}.map(unref).collect<std::set<int>>(), ElementsAreArray({1, 2, 3}));
+    EXPECT_EQ(LazyIterator{std::string_view{"abc"}}.collect<std::string>(), "abc");
+
+    auto counts = LazyIterator{vec}
+                      .map([](auto x) { return std::pair{x.get(), x.get() * 10}; })
+                      .collect<std::unordered_map<int, int>>();
+
+    EXPECT_EQ(counts.size(), 3);
+    EXPECT_EQ(counts.at(2), 20);
+}
+
+TEST(TestIterator, TestCollectPmrContainer)
+{
+    auto storage  = std::array<std::byte, 1024>{};
+    auto resource = std::pmr::monotonic_buffer_resource{storage.data(), storage.size(),
+                                                        std::pmr::null_memory_resource()};
+    auto vec      = std::vector{1, 2, 3};
+
+    auto result =
+        LazyIterator{vec}.map([](auto x) { return x.get(); }).collect<std::pmr::vector<int>>(
+            &resource);
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 3}));
+    EXPECT_EQ(result.get_allocator().resource(), &resource);
+}
+
+TEST(TestIterator, TestCollectIntoInfiniteIterator)
+{
+    auto vec    = std::vector{1, 2};
+    auto buffer = std::vector<int>{};
+    auto window = std::array<int, 3>{};
+    auto it     = LazyIterator{vec}.map([](auto x) { return x.get(); }).cycle();
+
+    EXPECT_THROW(it.collectInto(buffer), std::length_error);
+    EXPECT_EQ(it.collectInto(std::span<int>{window}), 3);
+    EXPECT_THAT(window, ElementsAreArray({1, 2, 1}));
+}
@@ -0,0 +1,117 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+#include <utility>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+using ::testing::FieldsAre;
+
+using Event = std::pair<int, std::string>;
+using User  = std::pair<int, std::string>;
+
+auto idOf = [](const auto& x) { return x.get().first; };
+
+TEST(TestHashJoin, TestJoinPairsMatchingItems)
+{
+    auto users  = std::vector<User>{{1, "ann"}, {2, "bob"}, {3, "cid"}};
+    auto events = std::vector<Event>{{2, "login"}, {4, "login"}, {1, "logout"}};
+
+    auto result = LazyIterator{events}
+                      .hashJoin(LazyIterator{users}, idOf, idOf)
+                      .map([](auto x) {
+                          auto [event, user] = x;
+                          return user.get().second + " " + event.get().second;
+                      })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({"bob login", "ann logout"}));
+}
+
+TEST(TestHashJoin, TestDuplicateBuildKeysKeepTheirOrder)
+{
+    auto build = std::vector<User>{{1, "a"}, {2, "b"}, {1, "c"}, {1, "d"}};
+    auto probe = std::vector{1, 3, 1, 5, 7};
+
+    auto result = LazyIterator{probe}
+                      .hashJoin(LazyIterator{build}, idOf, [](auto x) { return x.get(); })
+                      .map([](auto x) { return std::get<1>(x).get().second; })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({"a", "c", "d", "a", "c", "d"}));
+}
+
+TEST(TestHashJoin, TestSmallerProbeSideIsBuilt)
+{
+    auto build = std::vector<User>{{1, "a"}, {2, "b"}, {1, "c"}, {2, "d"}};
+    auto probe = std::vector{2, 1};
+
+    auto result = LazyIterator{probe}
+                      .hashJoin(LazyIterator{build}, idOf, [](auto x) { return x.get(); })
+                      .map([](auto x) {
+                          auto [id, user] = x;
+                          return std::to_string(id.get()) + user.get().second;
+                      })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({"1a", "2b", "1c", "2d"}));
+}
+
+TEST(TestHashJoin, TestJoinWithRanges)
+{
+    auto it = range(4, 10).hashJoin(
+        range(0, 20).filter([](auto x) { return x % 3 == 0; }), [](auto x) { return x / 3; },
+        [](auto x) { return x; });
+
+    EXPECT_THAT(it.next().value(), FieldsAre(4, 12));
+    EXPECT_THAT(it.next().value(), FieldsAre(5, 15));
+    EXPECT_THAT(it.next().value(), FieldsAre(6, 18));
+    EXPECT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestHashJoin, TestSizeHint)
+{
+    auto vec = std::vector{1, 2};
+    auto key = [](auto x) { return x.get(); };
+
+    EXPECT_EQ(LazyIterator{vec}.hashJoin(LazyIterator{vec}, key, key).sizeHint(), 0);
+    EXPECT_EQ(LazyIterator{vec}.cycle().hashJoin(LazyIterator{vec}, key, key).sizeHint(),
+              std::nullopt);
+}
+
+TEST(TestHashJoin, TestSemiJoin)
+{
+    auto users  = std::vector<User>{{1, "ann"}, {3, "cid"}};
+    auto events = std::vector<Event>{{2, "a"}, {1, "b"}, {3, "c"}, {1, "d"}};
+
+    auto result = LazyIterator{events}
+                      .semiJoin(LazyIterator{users}, idOf, idOf)
+                      .map([](auto x) { return x.get().second; })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({"b", "c", "d"}));
+}
+
+TEST(TestHashJoin, TestAntiJoin)
+{
+    auto seen = std::vector{2, 4, 6};
+    auto key  = [](auto x) { return x; };
+
+    auto result = range(0, 8).antiJoin(LazyIterator{seen}.map([](auto x) { return x.get(); }),
+                                       key, key);
+
+    EXPECT_THAT(result.collect(), ElementsAreArray({0, 1, 3, 5, 7}));
+}
+
+TEST(TestHashJoin, TestEmptyBuildSide)
+{
+    auto empty = std::vector<int>{};
+    auto key   = [](auto x) { return static_cast<int>(x); };
+
+    EXPECT_EQ(range(0, 5).hashJoin(LazyIterator{empty}, key, key).count(), 0);
+    EXPECT_EQ(range(0, 5).antiJoin(LazyIterator{empty}, key, key).count(), 5);
+}
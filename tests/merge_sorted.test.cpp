@@ -0,0 +1,117 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+#include <utility>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::mergeSorted;
+using ::rusty_iterators::iterator::mergeSortedBy;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestMergeSorted, TestMergeTwoIterators)
+{
+    auto v1 = std::vector{1, 4, 6, 9};
+    auto v2 = std::vector{2, 3, 7};
+
+    auto result = LazyIterator{v1}.mergeSorted(LazyIterator{v2}).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 3, 4, 6, 7, 9}));
+}
+
+TEST(TestMergeSorted, TestMergeIteratorsOfDifferentTypes)
+{
+    auto result = range(1, 4)
+                      .mergeSorted(range(0, 20, 4), range(3, 6).map([](auto x) { return x * 2; }))
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({0, 1, 2, 3, 4, 6, 8, 8, 10, 12, 16}));
+}
+
+TEST(TestMergeSorted, TestMergeWithoutOthers)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THAT(LazyIterator{vec}.mergeSorted().collect(), ElementsAreArray({1, 2, 3}));
+}
+
+TEST(TestMergeSorted, TestMergeIsStable)
+{
+    using Entry = std::pair<int, char>;
+
+    auto v1 = std::vector<Entry>{{1, 'a'}, {2, 'b'}, {2, 'c'}};
+    auto v2 = std::vector<Entry>{{1, 'd'}, {2, 'e'}};
+    auto v3 = std::vector<Entry>{{0, 'f'}, {2, 'g'}};
+
+    auto result = LazyIterator{v1}
+                      .mergeSortedBy([](const auto& x) { return x.get().first; },
+                                     LazyIterator{v2}, LazyIterator{v3})
+                      .map([](auto x) { return x.get().second; })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({'f', 'a', 'd', 'b', 'c', 'e', 'g'}));
+}
+
+TEST(TestMergeSorted, TestMergeRuntimeNumberOfIterators)
+{
+    auto shards = std::vector<std::vector<int>>{};
+
+    for (int i = 0; i < 37; i++)
+        shards.push_back(range(i, 1'000, 37).collect());
+
+    auto its = std::vector<LazyIterator<std::vector<int>>>{};
+
+    for (auto& shard : shards)
+        its.emplace_back(shard);
+
+    auto merged = mergeSorted(std::move(its));
+
+    ASSERT_EQ(merged.sizeHint(), 1'000);
+    EXPECT_THAT(merged.map([](auto x) { return x.get(); }).collect(),
+                ElementsAreArray(range(0, 1'000).collect()));
+}
+
+TEST(TestMergeSorted, TestMergeEmptyAndExhaustedIterators)
+{
+    auto empty = std::vector<int>{};
+    auto vec   = std::vector{1, 5};
+    auto its   = std::vector<LazyIterator<std::vector<int>>>{};
+
+    its.emplace_back(empty);
+    its.emplace_back(vec);
+    its.emplace_back(empty);
+
+    EXPECT_THAT(mergeSorted(std::move(its)).map([](auto x) { return x.get(); }).collect(),
+                ElementsAreArray({1, 5}));
+    EXPECT_EQ(mergeSorted(std::vector<LazyIterator<std::vector<int>>>{}).next(), std::nullopt);
+}
+
+TEST(TestMergeSorted, TestMergeSortedByStrings)
+{
+    auto v1  = std::vector<std::string>{"a", "ccc", "eeeee"};
+    auto v2  = std::vector<std::string>{"bb", "dddd"};
+    auto its = std::vector<LazyIterator<std::vector<std::string>>>{};
+
+    its.emplace_back(v1);
+    its.emplace_back(v2);
+
+    auto result = mergeSortedBy([](const auto& x) { return x.get().size(); }, std::move(its))
+                      .collect();
+    auto owned = std::vector<std::string>(result.begin(), result.end());
+
+    EXPECT_THAT(owned, ElementsAreArray({"a", "bb", "ccc", "dddd", "eeeee"}));
+}
+
+TEST(TestMergeSorted, TestMergeAndDedup)
+{
+    auto v1 = std::vector{1, 2, 4, 4};
+    auto v2 = std::vector{2, 3, 4};
+
+    auto result = LazyIterator{v1}.mergeSorted(LazyIterator{v2}).dedup().collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 3, 4}));
+}
@@ -0,0 +1,103 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestParMapIterator, CollectPreservesOrder)
+{
+    auto vec = std::vector{5, 4, 3, 2, 1};
+    auto it  = LazyIterator{vec}.parMap(
+        [](auto x) {
+            // Earlier items take longer, so they finish last.
+            std::this_thread::sleep_for(std::chrono::milliseconds(x));
+            return x * 2;
+        },
+        4, 4);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{10, 8, 6, 4, 2}));
+}
+
+TEST(TestParMapIterator, MapToDifferentType)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.parMap([](auto x) { return std::to_string(x); }, 2);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{"1", "2", "3"}));
+}
+
+TEST(TestParMapIterator, MatchesSequentialMap)
+{
+    auto f        = [](auto x) { return x * x % 7; };
+    auto expected = LazyIterator{std::views::iota(0, 10000)}.map(f).collect();
+    auto actual   = LazyIterator{std::views::iota(0, 10000)}.parMap(f, 3, 5).collect();
+
+    EXPECT_THAT(actual, ElementsAreArray(expected));
+}
+
+TEST(TestParMapIterator, SizeHintIsTheSameAsUpstream)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.parMap([](auto x) { return x; }, 1, 2);
+
+    ASSERT_EQ(it.sizeHint(), 3);
+
+    it.next();
+
+    ASSERT_EQ(it.sizeHint(), 2);
+}
+
+TEST(TestParMapIterator, CountDoesNotCallFunction)
+{
+    auto calls = std::atomic<int>{0};
+    auto vec   = std::vector{1, 2, 3, 4, 5, 6};
+    auto it    = LazyIterator{vec}.parMap(
+        [&calls](auto x) {
+            calls++;
+            return x;
+        },
+        2, 2);
+
+    ASSERT_EQ(it.next(), 1);
+    ASSERT_EQ(it.count(), 5);
+    ASSERT_LE(calls.load(), 3);
+}
+
+TEST(TestParMapIterator, RethrowExceptionInOrder)
+{
+    auto vec = std::vector{1, 2, 3, 4};
+    auto it  = LazyIterator{vec}.parMap(
+        [](auto x) {
+            if (x == 3)
+                throw std::runtime_error{"Bad item."};
+            return x;
+        },
+        2, 4);
+
+    ASSERT_EQ(it.next(), 1);
+    ASSERT_EQ(it.next(), 2);
+    EXPECT_THROW(it.next(), std::runtime_error);
+    ASSERT_EQ(it.next(), 4);
+    ASSERT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestParMapIterator, BoundedInFlightWindow)
+{
+    auto pulled = 0;
+    auto it     = LazyIterator{std::views::iota(0)}
+                  .inspect([&pulled](auto _) { pulled++; })
+                  .parMap([](auto x) { return x; }, 2, 3)
+                  .take(2);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{0, 1}));
+    ASSERT_LE(pulled, 4);
+}
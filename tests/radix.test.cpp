@@ -0,0 +1,125 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestRadixSortedBy, TestSortSignedKeys)
+{
+    auto vec = std::vector<int64_t>{5, -3, 0, std::numeric_limits<int64_t>::min(), 42, -3,
+                                    std::numeric_limits<int64_t>::max(), 7};
+    auto expected = vec;
+    std::ranges::sort(expected);
+
+    auto result = LazyIterator{vec}.radixSortedBy([](auto x) { return x.get(); });
+
+    EXPECT_EQ(result.size(), vec.size());
+    EXPECT_TRUE(std::ranges::equal(result, expected, [](auto a, auto b) { return a.get() == b; }));
+}
+
+TEST(TestRadixSortedBy, TestSortFloatKeys)
+{
+    auto vec = std::vector{2.5, -0.5, 0.0, -100.25, 1e9, -1e-9, 3.0};
+    auto expected = vec;
+    std::ranges::sort(expected);
+
+    auto result = LazyIterator{vec}.map([](auto x) { return x.get(); }).radixSortedBy(
+        [](auto x) { return x; });
+
+    EXPECT_THAT(result, ElementsAreArray(expected));
+}
+
+TEST(TestRadixSortedBy, TestSortNumbersByTheirOwnType)
+{
+    auto vec = std::vector<uint32_t>(5'000);
+    std::ranges::generate(vec, [x = 1u]() mutable { return x *= 2654435761u; });
+
+    auto ascending = LazyIterator{vec}.map([](auto x) { return x.get(); }).radixSortedBy(
+        [](auto x) { return x; });
+    auto descending = LazyIterator{vec}.map([](auto x) { return x.get(); }).radixSortedBy(
+        [](auto x) { return ~x; });
+
+    auto expected = vec;
+    std::ranges::sort(expected);
+
+    EXPECT_THAT(ascending, ElementsAreArray(expected));
+    EXPECT_TRUE(std::ranges::equal(descending, expected | std::views::reverse));
+}
+
+TEST(TestRadixSortedBy, TestSortIsStable)
+{
+    auto it = range(0, 1000).map([](auto x) { return std::pair{static_cast<uint8_t>(x % 7), x}; });
+
+    auto result   = it.radixSortedBy([](const auto& x) { return x.first; });
+    auto expected = result;
+    std::ranges::stable_sort(expected, {}, [](const auto& x) { return x.first; });
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(TestRadixSortedBy, TestSortLargeItemsByIndex)
+{
+    auto words = std::vector<std::string>{"ccc", "a", "bbbb", "", "dd"};
+
+    auto result = LazyIterator{words}
+                      .map([](auto x) { return x.get(); })
+                      .radixSortedBy([](const auto& x) { return x.size(); });
+
+    EXPECT_THAT(result, ElementsAreArray({"", "a", "dd", "ccc", "bbbb"}));
+}
+
+TEST(TestRadixSortedBy, TestSortEmptyIterator)
+{
+    EXPECT_TRUE(range(0, 0).radixSortedBy([](auto x) { return x; }).empty());
+}
+
+TEST(TestPartitionByRadix, TestPartitionByLowBits)
+{
+    auto partitions = range(0, 100).partitionByRadix(2);
+
+    EXPECT_EQ(partitions.bucketCount(), 4);
+    EXPECT_EQ(partitions.size(), 100);
+
+    for (size_t bucket = 0; bucket < partitions.bucketCount(); bucket++)
+    {
+        auto expected = range(0, 100).filter([bucket](auto x) { return x % 4 == bucket; });
+        EXPECT_THAT(partitions.bucket(bucket), ElementsAreArray(expected.collect()));
+    }
+}
+
+TEST(TestPartitionByRadix, TestPartitionWithKeyAndManyBuckets)
+{
+    auto vec = std::vector<int>(10'000);
+    std::ranges::generate(vec, [x = 0u]() mutable { return static_cast<int>(x++ * 2654435761u); });
+
+    auto key        = [](int x) { return static_cast<uint32_t>(x) >> 16; };
+    auto partitions = LazyIterator{vec}.partitionByRadix(10, key);
+    auto expected   = std::vector<std::vector<int>>(1024);
+
+    for (auto x : vec)
+        expected[key(x) & 1023].push_back(x);
+
+    ASSERT_EQ(partitions.bucketCount(), expected.size());
+
+    for (size_t bucket = 0; bucket < expected.size(); bucket++)
+        EXPECT_THAT(partitions.bucket(bucket), ElementsAreArray(expected[bucket]));
+}
+
+TEST(TestPartitionByRadix, TestInvalidBucketAndBits)
+{
+    auto partitions = range(0, 10).partitionByRadix(0);
+
+    EXPECT_THAT(partitions.bucket(0), ElementsAreArray(range(0, 10).collect()));
+    EXPECT_THROW(std::ignore = partitions.bucket(1), std::out_of_range);
+    EXPECT_THROW(std::ignore = range(0, 10).partitionByRadix(17), std::invalid_argument);
+}
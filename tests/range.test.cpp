@@ -0,0 +1,113 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/range.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestRangeIterator, CollectRange)
+{
+    EXPECT_THAT(range(0, 5).collect(), ElementsAreArray(std::array{0, 1, 2, 3, 4}));
+}
+
+TEST(TestRangeIterator, CollectRangeWithStep)
+{
+    EXPECT_THAT(range(1, 10, 3).collect(), ElementsAreArray(std::array{1, 4, 7}));
+}
+
+TEST(TestRangeIterator, CollectDecreasingRange)
+{
+    EXPECT_THAT(range(5, -5, -4).collect(), ElementsAreArray(std::array{5, 1, -3}));
+}
+
+TEST(TestRangeIterator, EmptyRange)
+{
+    ASSERT_EQ(range(5, 5).sizeHint(), 0);
+    ASSERT_EQ(range(5, 0).next(), std::nullopt);
+    ASSERT_EQ(range(0, 5, -1).count(), 0);
+}
+
+TEST(TestRangeIterator, ZeroStepThrows)
+{
+    EXPECT_THROW(std::ignore = range(0, 5, 0), std::length_error);
+}
+
+TEST(TestRangeIterator, MixedIntegerTypes)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = range(0, vec.size());
+
+    static_assert(std::is_same_v<decltype(it)::Type, size_t>);
+    ASSERT_EQ(it.count(), 3);
+}
+
+TEST(TestRangeIterator, SizeHintIsExact)
+{
+    auto it = range(0, 10, 3);
+
+    ASSERT_EQ(it.sizeHint(), 4);
+
+    it.next();
+
+    ASSERT_EQ(it.sizeHint(), 3);
+}
+
+TEST(TestRangeIterator, AdvanceByJumpsToElement)
+{
+    auto it = range(0, 100, 2);
+
+    it.advanceBy(10);
+
+    ASSERT_EQ(it.next(), 20);
+    ASSERT_EQ(it.nth(4), 30);
+    ASSERT_EQ(it.nth(100), std::nullopt);
+}
+
+TEST(TestRangeIterator, SumMatchesSequentialSum)
+{
+    ASSERT_EQ(range(0, 10001).sum(), 50005000);
+    ASSERT_EQ(range(3, 20, 4).sum(), 3 + 7 + 11 + 15 + 19);
+    ASSERT_EQ(range(10, -10, -3).sum(), range(10, -10, -3).fold(0, std::plus{}));
+}
+
+TEST(TestRangeIterator, SumWrapsAroundLikeSequentialSum)
+{
+    auto expected = range(uint8_t{0}, uint8_t{255}).fold(uint8_t{0}, [](uint8_t acc, uint8_t x) {
+        return static_cast<uint8_t>(acc + x);
+    });
+
+    ASSERT_EQ(range(uint8_t{0}, uint8_t{255}).sum(), expected);
+}
+
+TEST(TestRangeIterator, LastMinAndMax)
+{
+    ASSERT_EQ(range(0, 10, 3).last(), 9);
+    ASSERT_EQ(range(0, 10, 3).min(), 0);
+    ASSERT_EQ(range(0, 10, 3).max(), 9);
+    ASSERT_EQ(range(10, 0, -3).min(), 1);
+    ASSERT_EQ(range(10, 0, -3).max(), 10);
+    ASSERT_EQ(range(0, 0).max(), std::nullopt);
+}
+
+TEST(TestRangeIterator, RangeEndingAtTypeLimit)
+{
+    constexpr auto limit = std::numeric_limits<int8_t>::max();
+
+    auto it = range(static_cast<int8_t>(limit - 2), limit);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array<int8_t, 2>{limit - 2, limit - 1}));
+}
+
+TEST(TestRangeIterator, ComposesWithAdapters)
+{
+    auto result = range(0, 10).filter([](auto x) { return x % 2 == 0; }).map([](auto x) {
+        return x * x;
+    });
+
+    EXPECT_THAT(result.collect(), ElementsAreArray(std::array{0, 4, 16, 36, 64}));
+}
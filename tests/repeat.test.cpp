@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/repeat.hpp>
+
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::repeat;
+using ::rusty_iterators::iterator::repeatN;
+using ::testing::ElementsAreArray;
+
+TEST(TestRepeatIterator, RepeatForever)
+{
+    auto it = repeat(std::string{"a"});
+
+    ASSERT_EQ(it.sizeHint(), std::nullopt);
+    EXPECT_THAT(it.take(3).collect(), ElementsAreArray(std::array{"a", "a", "a"}));
+}
+
+TEST(TestRepeatIterator, NthReturnsItem)
+{
+    auto it = repeat(5);
+
+    ASSERT_EQ(it.nth(1'000'000'000), 5);
+}
+
+TEST(TestRepeatIterator, CollectInfiniteRepeatThrows)
+{
+    EXPECT_THROW(std::ignore = repeat(1).collect(), std::length_error);
+}
+
+TEST(TestRepeatNIterator, RepeatNTimes)
+{
+    auto it = repeatN(std::string{"a"}, 3);
+
+    ASSERT_EQ(it.sizeHint(), 3);
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{"a", "a", "a"}));
+}
+
+TEST(TestRepeatNIterator, RepeatZeroTimes)
+{
+    ASSERT_EQ(repeatN(1, 0).next(), std::nullopt);
+}
+
+TEST(TestRepeatNIterator, AdvanceByAndCount)
+{
+    auto it = repeatN(1, 10);
+
+    it.advanceBy(4);
+
+    ASSERT_EQ(it.count(), 6);
+}
+
+TEST(TestRepeatNIterator, ClosedFormTerminals)
+{
+    ASSERT_EQ(repeatN(3, 5).sum(), 15);
+    ASSERT_EQ(repeatN(3, 5).min(), 3);
+    ASSERT_EQ(repeatN(3, 5).max(), 3);
+    ASSERT_EQ(repeatN(3, 5).last(), 3);
+    ASSERT_EQ(repeatN(3, 0).last(), std::nullopt);
+}
+
+TEST(TestRepeatNIterator, SumNonArithmeticItems)
+{
+    ASSERT_EQ(repeatN(std::string{"ab"}, 3).sum(), "ababab");
+}
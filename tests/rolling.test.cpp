@@ -0,0 +1,133 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+TEST(TestRollingIterator, TestRollingSum)
+{
+    auto vec    = std::vector{1, 2, 3, 4, 5};
+    auto result = LazyIterator{vec}.rollingSum(3).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({6, 9, 12}));
+}
+
+TEST(TestRollingIterator, TestRollingSumWindowOfOne)
+{
+    auto result = range(1, 5).rollingSum(1).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 3, 4}));
+}
+
+TEST(TestRollingIterator, TestWindowBiggerThanIterator)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_TRUE(LazyIterator{vec}.rollingSum(4).collect().empty());
+    EXPECT_TRUE(LazyIterator{vec}.rollingMin(4).collect().empty());
+}
+
+TEST(TestRollingIterator, TestZeroSizeWindow)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THROW(auto _ = LazyIterator{vec}.rollingSum(0), std::length_error);
+    EXPECT_THROW(auto _ = LazyIterator{vec}.rollingMax(0), std::length_error);
+}
+
+TEST(TestRollingIterator, TestRollingMean)
+{
+    auto vec    = std::vector{1, 2, 3, 4, 6};
+    auto result = LazyIterator{vec}.rollingMean(2).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1.5, 2.5, 3.5, 5.0}));
+}
+
+TEST(TestRollingIterator, TestRollingMeanOfFloatsDoesNotDrift)
+{
+    // Values of very different magnitude lose precision when subtracted.
+    auto it = range(0, 10'000).map([](auto x) { return x % 100 == 0 ? 1e12 : 0.1; });
+
+    auto last = it.rollingMean(10).last();
+
+    ASSERT_TRUE(last.has_value());
+    EXPECT_DOUBLE_EQ(last.value(), 0.1);
+}
+
+TEST(TestRollingIterator, TestRollingMin)
+{
+    auto vec    = std::vector{4, 2, 12, 11, -5, 3, 3, 7};
+    auto result = LazyIterator{vec}.rollingMin(3).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({2, 2, -5, -5, -5, 3}));
+}
+
+TEST(TestRollingIterator, TestRollingMax)
+{
+    auto vec    = std::vector{4, 2, 12, 11, -5, 3, 3, 7};
+    auto result = LazyIterator{vec}.rollingMax(3).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({12, 12, 12, 11, 3, 7}));
+}
+
+TEST(TestRollingIterator, TestRollingMaxMatchesNaiveWindow)
+{
+    auto values = range(0, 500).map([](auto x) { return (x * 7919) % 113; }).collect();
+
+    auto expected = LazyIterator{values}
+                        .movingWindow(17)
+                        .map([](auto window) {
+                            auto best = window[0].get();
+                            for (auto x : window)
+                                best = std::max(best, x.get());
+                            return best;
+                        })
+                        .collect();
+    auto result   = LazyIterator{values}.rollingMax(17).collect();
+
+    EXPECT_THAT(result, ElementsAreArray(expected));
+}
+
+TEST(TestRollingIterator, TestRollingMinOfStrings)
+{
+    auto vec    = std::vector<std::string>{"c", "a", "d", "e"};
+    auto result = LazyIterator{vec}.rollingMin(2).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({"a", "a", "d"}));
+}
+
+TEST(TestRollingIterator, TestRollingFold)
+{
+    auto vec    = std::vector{1, 2, 3, 4};
+    auto result = LazyIterator{vec}
+                      .rollingFold(
+                          2, 1, [](auto acc, auto x) { return acc * x; },
+                          [](auto acc, auto x) { return acc / x; })
+                      .collect();
+
+    EXPECT_THAT(result, ElementsAreArray({2, 6, 12}));
+}
+
+TEST(TestRollingIterator, TestSizeHint)
+{
+    auto vec = std::vector{1, 2, 3, 4, 5};
+    auto it  = LazyIterator{vec}.rollingSum(3);
+
+    EXPECT_EQ(it.sizeHint(), 3);
+    std::ignore = it.next();
+    EXPECT_EQ(it.sizeHint(), 2);
+}
+
+TEST(TestRollingIterator, TestSizeHintOfInfiniteIterator)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.cycle().rollingMax(2);
+
+    EXPECT_EQ(it.sizeHint(), std::nullopt);
+}
@@ -0,0 +1,114 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/random.hpp>
+#include <rusty_iterators/range.hpp>
+#include <stdexcept>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::rusty_iterators::random::Xoshiro256;
+using ::testing::ElementsAreArray;
+
+TEST(TestSampleIterator, TestSampleIsReproducible)
+{
+    auto first  = range(0, 10'000).sample(0.1, 42).collect();
+    auto second = range(0, 10'000).sample(0.1, 42).collect();
+
+    EXPECT_THAT(first, ElementsAreArray(second));
+    EXPECT_TRUE(std::ranges::is_sorted(first));
+}
+
+TEST(TestSampleIterator, TestSampleSkipsWithoutVisitingItems)
+{
+    // Range skips in constant time, so this is only as slow as the sample.
+    auto result = range(size_t{0}, size_t{100'000'000}).sample(0.001, 7).count();
+
+    EXPECT_NEAR(static_cast<double>(result), 100'000, 1500);
+}
+
+TEST(TestSampleIterator, TestSampleOfVector)
+{
+    auto vec    = range(0, 100'000).collect();
+    auto result = LazyIterator{vec}.sample(0.25, 3).collect();
+
+    EXPECT_NEAR(static_cast<double>(result.size()), 25'000, 500);
+}
+
+TEST(TestSampleIterator, TestSampleEverything)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THAT(LazyIterator{vec}.sample(1).collect(), ElementsAreArray({1, 2, 3}));
+}
+
+TEST(TestSampleIterator, TestSampleNothing)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.cycle().sample(0);
+
+    EXPECT_EQ(it.sizeHint(), 0);
+    EXPECT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestSampleIterator, TestInvalidProbability)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THROW(std::ignore = LazyIterator{vec}.sample(1.5), std::invalid_argument);
+    EXPECT_THROW(std::ignore = LazyIterator{vec}.sample(-0.1), std::invalid_argument);
+}
+
+TEST(TestSampleIterator, TestSampleSizeHint)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_EQ(LazyIterator{vec}.sample(0.5).sizeHint(), 0);
+    EXPECT_EQ(LazyIterator{vec}.cycle().sample(0.5).sizeHint(), std::nullopt);
+}
+
+TEST(TestSampleIterator, TestReservoirOfShortIterator)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THAT(LazyIterator{vec}.reservoir(5), ElementsAreArray({1, 2, 3}));
+    EXPECT_TRUE(LazyIterator{vec}.reservoir(0).empty());
+}
+
+TEST(TestSampleIterator, TestReservoirIsReproducible)
+{
+    auto first  = range(0, 100'000).reservoir(10, 1);
+    auto second = range(0, 100'000).reservoir(10, 1);
+
+    EXPECT_EQ(first.size(), 10);
+    EXPECT_THAT(first, ElementsAreArray(second));
+}
+
+TEST(TestSampleIterator, TestReservoirIsUniform)
+{
+    // Every item should land in the reservoir of 10 out of 100 items in 10%
+    // of the runs.
+    auto hits = std::vector<size_t>(100, 0);
+
+    for (uint64_t seed = 0; seed < 20'000; seed++)
+    {
+        for (auto x : range(0, 100).reservoir(10, seed))
+            hits[x] += 1;
+    }
+
+    for (auto count : hits)
+        EXPECT_NEAR(static_cast<double>(count), 2000, 200);
+}
+
+TEST(TestSampleIterator, TestRandomBelow)
+{
+    auto rng = Xoshiro256{5};
+
+    for (size_t i = 0; i < 1000; i++)
+    {
+        EXPECT_LT(rng.below(7), 7);
+        EXPECT_GT(rng.unit(), 0);
+        EXPECT_LE(rng.unit(), 1);
+    }
+}
@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <numeric>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::rusty_iterators::iterator::ScanType;
+using ::testing::ElementsAreArray;
+
+TEST(TestScanIterator, TestScanYieldsEveryAccumulator)
+{
+    auto vec = std::vector<std::string>{"a", "b", "c"};
+    auto it =
+        LazyIterator{vec}.scan(std::string{}, [](auto acc, auto x) { return acc + x.get(); });
+
+    EXPECT_EQ(it.sizeHint(), 3);
+    EXPECT_THAT(it.collect(), ElementsAreArray({"a", "ab", "abc"}));
+}
+
+TEST(TestScanIterator, TestScanRunningMax)
+{
+    auto vec = std::vector{3, 1, 4, 1, 5, 9, 2, 6};
+    auto it  = LazyIterator{vec}.scan(0, [](auto acc, auto x) { return std::max(acc, x.get()); });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray({3, 3, 4, 4, 5, 9, 9, 9}));
+}
+
+TEST(TestPrefixSum, TestInclusiveAndExclusiveSums)
+{
+    auto lengths = std::vector{3, 0, 5, 2};
+
+    EXPECT_THAT(LazyIterator{lengths}.prefixSum().collect(), ElementsAreArray({3, 3, 8, 10}));
+    EXPECT_THAT(LazyIterator{lengths}.exclusivePrefixSum().collect(),
+                ElementsAreArray({0, 3, 3, 8}));
+}
+
+TEST(TestPrefixSum, TestContiguousSourceAcrossBlocks)
+{
+    auto vec      = range(0, 1000).collect();
+    auto expected = std::vector<int>(vec.size());
+    std::inclusive_scan(vec.begin(), vec.end(), expected.begin());
+
+    auto it = LazyIterator{vec}.prefixSum();
+
+    EXPECT_EQ(it.next(), 0);
+    EXPECT_EQ(it.sizeHint(), 999);
+    EXPECT_EQ(it.count(), 999);
+
+    EXPECT_THAT(LazyIterator{vec}.prefixSum().collect(), ElementsAreArray(expected));
+    EXPECT_THAT(range(0, 1000).prefixSum().collect(), ElementsAreArray(expected));
+}
+
+TEST(TestPrefixSum, TestSizeHint)
+{
+    EXPECT_EQ(range(0, 5).exclusivePrefixSum().sizeHint(), 5);
+    EXPECT_EQ(range(0, 5).cycle().prefixSum().sizeHint(), std::nullopt);
+}
+
+TEST(TestPrefixSum, TestParallelPrefixSum)
+{
+    auto vec = std::vector<int64_t>(1'000'003);
+    std::iota(vec.begin(), vec.end(), -500'000);
+
+    auto inclusive = std::vector<int64_t>(vec.size());
+    auto exclusive = std::vector<int64_t>(vec.size());
+    std::inclusive_scan(vec.begin(), vec.end(), inclusive.begin());
+    std::exclusive_scan(vec.begin(), vec.end(), exclusive.begin(), int64_t{0});
+
+    EXPECT_EQ(LazyIterator{vec}.parPrefixSum(ScanType::Inclusive, 4), inclusive);
+    EXPECT_EQ(LazyIterator{vec}.parPrefixSum(ScanType::Exclusive, 3), exclusive);
+    EXPECT_EQ(LazyIterator{vec}.map([](auto x) { return x.get(); }).parPrefixSum(), inclusive);
+    EXPECT_TRUE(range(0, 0).parPrefixSum().empty());
+}
@@ -0,0 +1,173 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::rusty_iterators::statistics::BloomFilter;
+using ::rusty_iterators::statistics::HyperLogLog;
+using ::rusty_iterators::statistics::SpaceSaving;
+
+TEST(TestSketches, TestApproxDistinctOfSmallSet)
+{
+    auto vec = std::vector{1, 2, 3, 2, 1, 3, 3, 4};
+
+    EXPECT_EQ(LazyIterator{vec}.approxDistinct(), 4);
+}
+
+TEST(TestSketches, TestApproxDistinctOfEmptyIterator)
+{
+    auto vec = std::vector<int>{};
+
+    EXPECT_EQ(LazyIterator{vec}.approxDistinct(), 0);
+}
+
+TEST(TestSketches, TestApproxDistinctWithDuplicates)
+{
+    auto result = range(0, 1'000'000).map([](auto x) { return x % 100'000; }).approxDistinct(14);
+
+    EXPECT_NEAR(static_cast<double>(result), 100'000, 100'000 * 0.03);
+}
+
+TEST(TestSketches, TestApproxDistinctOfStrings)
+{
+    auto result = range(0, 20'000).map([](auto x) { return std::to_string(x % 5000); });
+
+    EXPECT_NEAR(static_cast<double>(std::move(result).approxDistinct()), 5000, 5000 * 0.05);
+}
+
+TEST(TestSketches, TestApproxDistinctWithCustomHasher)
+{
+    // Hashing only the parity makes every odd and every even number equal.
+    auto parity = [](int x) -> uint64_t { return rusty_iterators::hashing::mix(x % 2); };
+
+    EXPECT_EQ(range(0, 1000).approxDistinct(12, parity), 2);
+}
+
+TEST(TestSketches, TestMergeHyperLogLogs)
+{
+    auto sketch = range(0, 60'000).hyperLogLog();
+    sketch.merge(range(40'000, 100'000).hyperLogLog());
+
+    EXPECT_NEAR(static_cast<double>(sketch.estimate()), 100'000, 100'000 * 0.05);
+    EXPECT_THROW(sketch.merge(HyperLogLog{10}), std::invalid_argument);
+}
+
+TEST(TestSketches, TestInvalidPrecision)
+{
+    EXPECT_THROW(HyperLogLog{2}, std::length_error);
+    EXPECT_THROW(HyperLogLog{19}, std::length_error);
+}
+
+TEST(TestSketches, TestHeavyHitters)
+{
+    auto vec    = std::vector<std::string>{"a", "b", "a", "c", "a", "b", "d"};
+    auto result = LazyIterator{vec}.heavyHitters(3);
+
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].item, "a");
+    EXPECT_EQ(result[0].count, 3);
+    EXPECT_EQ(result[0].error, 0);
+}
+
+TEST(TestSketches, TestHeavyHittersFindFrequentItems)
+{
+    // Every tenth item is 7 and every tenth is 13, the rest are unique.
+    auto result = range(0, 100'000)
+                      .map([](auto x) { return x % 10 == 0 ? 7 : x % 10 == 5 ? 13 : x + 100; })
+                      .heavyHitters(20);
+
+    ASSERT_EQ(result.size(), 20);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_TRUE(result[i].item == 7 || result[i].item == 13);
+        EXPECT_GE(result[i].count, 10'000);
+        EXPECT_LE(result[i].count - result[i].error, 10'000);
+    }
+}
+
+TEST(TestSketches, TestHeavyHittersWithFewItems)
+{
+    auto vec    = std::vector{5, 5, 1};
+    auto result = LazyIterator{vec}.heavyHitters(10);
+
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].item, 5);
+    EXPECT_EQ(result[0].count, 2);
+    EXPECT_EQ(result[1].item, 1);
+    EXPECT_EQ(result[1].count, 1);
+}
+
+TEST(TestSketches, TestMergeSpaceSaving)
+{
+    auto first  = SpaceSaving<int>{3};
+    auto second = SpaceSaving<int>{3};
+
+    for (auto x : {1, 1, 2, 3})
+        first.add(x);
+    for (auto x : {1, 4, 4, 4})
+        second.add(x);
+
+    first.merge(second);
+    auto result = first.top();
+
+    // Item 4 took over a counter of 1, so it's overestimated by one.
+    ASSERT_EQ(result.size(), 3);
+    EXPECT_EQ(result[0].item, 4);
+    EXPECT_EQ(result[0].count, 4);
+    EXPECT_EQ(result[0].error, 1);
+    EXPECT_EQ(result[1].item, 1);
+    EXPECT_EQ(result[1].count, 3);
+}
+
+TEST(TestSketches, TestZeroCounters)
+{
+    EXPECT_THROW(SpaceSaving<int>{0}, std::length_error);
+}
+
+TEST(TestSketches, TestBloomFilterHasNoFalseNegatives)
+{
+    auto bloom = range(0, 10'000).collectBloom();
+
+    EXPECT_TRUE(range(0, 10'000).all([&bloom](auto x) {
+        return bloom.mayContain(rusty_iterators::hashing::Hash<int>{}(x));
+    }));
+}
+
+TEST(TestSketches, TestBloomFilterFalsePositiveRate)
+{
+    auto bloom    = range(0, 100'000).collectBloom(10);
+    auto positive = range(100'000, 200'000)
+                        .filter([&bloom](auto x) {
+                            return bloom.mayContain(rusty_iterators::hashing::Hash<int>{}(x));
+                        })
+                        .count();
+
+    // About 1% is expected, blocking costs a bit over the ideal 0.8%.
+    EXPECT_LT(positive, 2'000);
+}
+
+TEST(TestSketches, TestMergeBloomFilters)
+{
+    auto first  = BloomFilter{100};
+    auto second = BloomFilter{100};
+
+    first.add(1);
+    second.add(2);
+    first.merge(second);
+
+    EXPECT_TRUE(first.mayContain(1));
+    EXPECT_TRUE(first.mayContain(2));
+    EXPECT_THROW(first.merge(BloomFilter{10'000}), std::invalid_argument);
+}
+
+TEST(TestSketches, TestInvalidBitsPerKey)
+{
+    EXPECT_THROW(BloomFilter(10, 0), std::invalid_argument);
+    EXPECT_THROW(BloomFilter(10, -1), std::invalid_argument);
+}
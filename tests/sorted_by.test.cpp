@@ -0,0 +1,119 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
+
+auto scramble = [](auto x) { return (x * 7919) % 10'007; };
+auto identity = [](auto x) { return x; };
+
+TEST(TestSortedBy, TestSortInMemory)
+{
+    auto vec    = std::vector{5, 3, 9, 1, 7};
+    auto result = LazyIterator{vec}.sortedBy([](auto x) { return x.get(); }).collect();
+
+    EXPECT_THAT(result, ElementsAreArray({1, 3, 5, 7, 9}));
+}
+
+TEST(TestSortedBy, TestSortWithSpilledRuns)
+{
+    auto expected = range(0, 10'000).map(scramble).collect();
+    std::ranges::sort(expected);
+
+    // Room for 100 items, so the input is spilled in 100 runs.
+    auto it = range(0, 10'000).map(scramble).sortedBy(identity, 100 * sizeof(int));
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(expected));
+}
+
+struct Entry
+{
+    int key;
+    int order;
+
+    auto operator==(const Entry&) const -> bool = default;
+};
+
+TEST(TestSortedBy, TestSortIsStable)
+{
+    auto vec = range(0, 1'000).map([](auto x) { return Entry{x % 7, x}; }).collect();
+
+    auto inMemory = LazyIterator{vec}.sortedBy([](auto x) { return x.get().key; }).collect();
+    auto spilled  = LazyIterator{vec}
+                       .map([](auto x) { return x.get(); })
+                       .sortedBy([](const auto& x) { return x.key; }, 30 * sizeof(Entry))
+                       .collect();
+
+    auto expected = vec;
+    std::ranges::stable_sort(expected, {}, &Entry::key);
+
+    ASSERT_EQ(spilled.size(), expected.size());
+    EXPECT_THAT(spilled, ElementsAreArray(expected));
+    EXPECT_TRUE(std::ranges::equal(inMemory, expected, {}, [](auto x) { return x.get(); }));
+}
+
+TEST(TestSortedBy, TestInputOfExactlyTheBudget)
+{
+    auto it = range(0, 10).map([](auto x) { return 9 - x; }).sortedBy(identity, 10 * sizeof(int));
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(range(0, 10).collect()));
+}
+
+TEST(TestSortedBy, TestSortEmptyIterator)
+{
+    auto vec = std::vector<int>{};
+    auto it  = LazyIterator{vec}.sortedBy([](auto x) { return x.get(); }, 0);
+
+    EXPECT_EQ(it.next(), std::nullopt);
+}
+
+TEST(TestSortedBy, TestSizeHint)
+{
+    auto it = range(0, 100).map(scramble).sortedBy(identity, 16);
+
+    EXPECT_EQ(it.sizeHint(), 100);
+    std::ignore = it.next();
+    EXPECT_EQ(it.sizeHint(), 99);
+}
+
+TEST(TestSortedBy, TestSpillToDirectory)
+{
+    auto dir = std::filesystem::temp_directory_path() / "rusty_iterators_sorted_by_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directory(dir);
+
+    auto filesIn = [](const auto& path) {
+        return std::distance(std::filesystem::directory_iterator{path},
+                             std::filesystem::directory_iterator{});
+    };
+
+    {
+        auto it = range(0, 1'000).map(scramble).sortedBy(identity, 100 * sizeof(int), dir);
+
+        EXPECT_TRUE(it.next().has_value());
+        EXPECT_EQ(filesIn(dir), 10);
+        EXPECT_TRUE(std::ranges::is_sorted(it.collect()));
+    }
+    EXPECT_EQ(filesIn(dir), 0);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(TestSortedBy, TestSpillToMissingDirectory)
+{
+    auto dir = std::filesystem::temp_directory_path() / "rusty_iterators_missing_dir";
+    auto it  = range(0, 1'000).map(scramble).sortedBy(identity, 100 * sizeof(int), dir);
+
+    EXPECT_THROW(std::ignore = it.next(), std::runtime_error);
+}
+
+TEST(TestSortedBy, TestSortInfiniteIterator)
+{
+    EXPECT_THROW(std::ignore = range(0, 3).cycle().sortedBy(identity).next(), std::length_error);
+}
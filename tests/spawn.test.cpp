@@ -0,0 +1,100 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+
+#include <atomic>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestSpawnIterator, CollectItemsInOrder)
+{
+    auto vec = std::vector{1, 2, 3, 4, 5};
+    auto it  = LazyIterator{vec}.map([](auto x) { return x * 2; }).spawn(2, 2);
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{2, 4, 6, 8, 10}));
+}
+
+TEST(TestSpawnIterator, RunsUpstreamOnWorkerThread)
+{
+    auto vec    = std::vector{1, 2, 3};
+    auto caller = std::this_thread::get_id();
+    auto it     = LazyIterator{vec}
+                  .map([](auto x) { return std::this_thread::get_id(); })
+                  .spawn();
+
+    auto ids = it.collect();
+
+    ASSERT_EQ(ids.size(), 3);
+    ASSERT_NE(ids[0], caller);
+}
+
+TEST(TestSpawnIterator, SizeHintFollowsUpstream)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.spawn(1, 1);
+
+    ASSERT_EQ(it.sizeHint(), 3);
+
+    it.next();
+
+    ASSERT_EQ(it.sizeHint(), 2);
+}
+
+TEST(TestSpawnIterator, FoldLargeInput)
+{
+    auto it = LazyIterator{std::views::iota(0, 100000)}
+                  .filter([](auto x) { return x % 2 == 0; })
+                  .spawn(4, 64);
+
+    ASSERT_EQ(it.fold(0L, [](auto acc, auto x) { return acc + x; }), 2499950000L);
+}
+
+TEST(TestSpawnIterator, RethrowUpstreamException)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}
+                  .map([](auto x) {
+                      if (x == 3)
+                          throw std::runtime_error{"Bad item."};
+                      return x;
+                  })
+                  .spawn(2, 1);
+
+    ASSERT_EQ(it.next(), 1);
+    ASSERT_EQ(it.next(), 2);
+    EXPECT_THROW(it.next(), std::runtime_error);
+}
+
+TEST(TestSpawnIterator, EarlyTerminationStopsWorker)
+{
+    auto produced = std::atomic<int>{0};
+
+    {
+        auto it = LazyIterator{std::views::iota(0)}
+                      .inspect([&produced](auto _) { produced++; })
+                      .spawn(2, 4)
+                      .take(3);
+
+        EXPECT_THAT(it.collect(), ElementsAreArray(std::array{0, 1, 2}));
+    }
+
+    // Consumed batch, full ring and the batch which was being built.
+    ASSERT_LE(produced.load(), 4 + 2 * 4 + 4);
+}
+
+TEST(TestSpawnIterator, DropWithoutConsuming)
+{
+    auto it = LazyIterator{std::views::iota(0)}.spawn(1, 1);
+}
+
+TEST(TestSpawnIterator, ZeroBatchSizeThrows)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THROW(std::ignore = LazyIterator{vec}.spawn(1, 0), std::length_error);
+}
@@ -0,0 +1,136 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/spsc_ring.hpp>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ::rusty_iterators::concurrency::SpscRing;
+using ::testing::ElementsAreArray;
+
+TEST(TestSpscRing, CapacityIsRoundedToPowerOfTwo)
+{
+    auto ring = SpscRing<int>{5};
+
+    ASSERT_EQ(ring.capacity(), 8);
+}
+
+TEST(TestSpscRing, ZeroCapacityThrows)
+{
+    EXPECT_THROW(SpscRing<int>{0}, std::length_error);
+}
+
+TEST(TestSpscRing, TryPushFailsWhenFull)
+{
+    auto ring = SpscRing<int>{2};
+
+    ASSERT_TRUE(ring.tryPush(1));
+    ASSERT_TRUE(ring.tryPush(2));
+    ASSERT_FALSE(ring.tryPush(3));
+
+    ASSERT_EQ(ring.tryPop(), 1);
+    ASSERT_TRUE(ring.tryPush(3));
+    ASSERT_EQ(ring.tryPop(), 2);
+    ASSERT_EQ(ring.tryPop(), 3);
+    ASSERT_EQ(ring.tryPop(), std::nullopt);
+}
+
+TEST(TestSpscRing, PopDrainsClosedRing)
+{
+    auto ring = SpscRing<int>{4};
+
+    ASSERT_TRUE(ring.push(1));
+    ASSERT_TRUE(ring.push(2));
+    ring.close();
+
+    ASSERT_TRUE(ring.isClosed());
+    ASSERT_EQ(ring.pop(), 1);
+    ASSERT_EQ(ring.pop(), 2);
+    ASSERT_EQ(ring.pop(), std::nullopt);
+}
+
+TEST(TestSpscRing, PushFailsOnCancelledRing)
+{
+    auto ring = SpscRing<int>{1};
+
+    ring.cancel();
+
+    ASSERT_TRUE(ring.isCancelled());
+    ASSERT_TRUE(ring.push(1));
+    ASSERT_FALSE(ring.push(2));
+}
+
+TEST(TestSpscRing, TransferItemsBetweenThreads)
+{
+    auto ring     = SpscRing<int>{4};
+    auto received = std::vector<int>{};
+    auto expected = std::vector<int>{};
+
+    for (int i = 0; i < 10000; i++)
+        expected.push_back(i);
+
+    auto producer = std::jthread{[&ring] {
+        for (int i = 0; i < 10000; i++)
+            ASSERT_TRUE(ring.push(std::move(i)));
+        ring.close();
+    }};
+
+    for (auto item = ring.pop(); item.has_value(); item = ring.pop())
+        received.push_back(item.value());
+
+    EXPECT_THAT(received, ElementsAreArray(expected));
+}
+
+TEST(TestSpscRing, CancelWakesUpBlockedProducer)
+{
+    auto ring = SpscRing<int>{1};
+
+    auto producer = std::jthread{[&ring] {
+        ASSERT_TRUE(ring.push(1));
+        ASSERT_FALSE(ring.push(2));
+    }};
+
+    ring.cancel();
+}
+
+TEST(TestSpscRing, PushManyStopsWhenFull)
+{
+    auto ring  = SpscRing<int>{4};
+    auto items = std::vector{1, 2, 3, 4, 5, 6};
+
+    ASSERT_EQ(ring.tryPushMany(items), 4);
+
+    auto out = std::vector<int>{};
+
+    ASSERT_EQ(ring.tryPopMany(out, 3), 3);
+    ASSERT_EQ(ring.tryPushMany(std::span{items}.subspan(4)), 2);
+    ASSERT_EQ(ring.tryPopMany(out, 10), 3);
+
+    EXPECT_THAT(out, ElementsAreArray(items));
+}
+
+TEST(TestSpscRing, TransferBatchesBetweenThreads)
+{
+    auto ring     = SpscRing<int>{8};
+    auto received = std::vector<int>{};
+    auto expected = std::vector<int>{};
+
+    for (int i = 0; i < 10000; i++)
+        expected.push_back(i);
+
+    auto producer = std::jthread{[&ring, items = expected]() mutable {
+        for (size_t i = 0; i < items.size(); i += 7)
+        {
+            auto batch = std::span{items}.subspan(i, std::min<size_t>(7, items.size() - i));
+            ASSERT_EQ(ring.pushMany(batch), batch.size());
+        }
+        ring.close();
+    }};
+
+    while (ring.popMany(received, 5) > 0)
+        ;
+
+    EXPECT_THAT(received, ElementsAreArray(expected));
+}
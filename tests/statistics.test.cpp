@@ -0,0 +1,174 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <stdexcept>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::rusty_iterators::statistics::Histogram;
+using ::rusty_iterators::statistics::Stats;
+using ::rusty_iterators::statistics::TDigest;
+using ::testing::ElementsAreArray;
+
+TEST(TestStatistics, TestStats)
+{
+    auto vec   = std::vector{2, 4, 4, 4, 5, 5, 7, 9};
+    auto stats = LazyIterator{vec}.stats();
+
+    EXPECT_EQ(stats.count(), 8);
+    EXPECT_DOUBLE_EQ(stats.mean(), 5);
+    EXPECT_DOUBLE_EQ(stats.variance(), 4);
+    EXPECT_DOUBLE_EQ(stats.stddev(), 2);
+    EXPECT_DOUBLE_EQ(stats.sampleVariance(), 32.0 / 7);
+    EXPECT_EQ(stats.min(), 2);
+    EXPECT_EQ(stats.max(), 9);
+}
+
+TEST(TestStatistics, TestStatsOfEmptyIterator)
+{
+    auto vec   = std::vector<double>{};
+    auto stats = LazyIterator{vec}.stats();
+
+    EXPECT_EQ(stats.count(), 0);
+    EXPECT_TRUE(std::isnan(stats.mean()));
+    EXPECT_TRUE(std::isnan(stats.variance()));
+    EXPECT_EQ(stats.min(), std::nullopt);
+    EXPECT_EQ(stats.max(), std::nullopt);
+}
+
+TEST(TestStatistics, TestStatsAreNumericallyStable)
+{
+    // The sum of squares would cancel out completely with such an offset.
+    auto stats = range(0, 1000).map([](auto x) { return 1e9 + (x % 2); }).stats();
+
+    EXPECT_DOUBLE_EQ(stats.mean(), 1e9 + 0.5);
+    EXPECT_DOUBLE_EQ(stats.variance(), 0.25);
+}
+
+TEST(TestStatistics, TestMergeStats)
+{
+    auto whole = range(0, 1000).stats();
+    auto left  = range(0, 300).stats();
+    auto right = range(300, 1000).stats();
+
+    left.merge(right);
+    left.merge(Stats{});
+
+    EXPECT_EQ(left.count(), whole.count());
+    EXPECT_DOUBLE_EQ(left.mean(), whole.mean());
+    EXPECT_DOUBLE_EQ(left.variance(), whole.variance());
+    EXPECT_EQ(left.min(), 0);
+    EXPECT_EQ(left.max(), 999);
+}
+
+TEST(TestStatistics, TestHistogram)
+{
+    auto vec       = std::vector{-1.0, 0.0, 0.5, 2.4, 2.5, 9.9, 10.0, 10.1};
+    auto histogram = LazyIterator{vec}.histogram(4, 0, 10);
+
+    EXPECT_THAT(histogram.counts(), ElementsAreArray({3, 1, 0, 2}));
+    EXPECT_EQ(histogram.underflow(), 1);
+    EXPECT_EQ(histogram.overflow(), 1);
+    EXPECT_DOUBLE_EQ(histogram.lowerEdge(1), 2.5);
+}
+
+TEST(TestStatistics, TestHistogramOfNaN)
+{
+    auto histogram = Histogram{2, 0, 1};
+    histogram.add(std::nan(""));
+
+    EXPECT_THAT(histogram.counts(), ElementsAreArray({0, 0}));
+    EXPECT_EQ(histogram.underflow(), 1);
+}
+
+TEST(TestStatistics, TestMergeHistograms)
+{
+    auto histogram = range(0, 50).histogram(5, 0, 100);
+    histogram.merge(range(50, 100).histogram(5, 0, 100));
+
+    EXPECT_THAT(histogram.counts(), ElementsAreArray({20, 20, 20, 20, 20}));
+    EXPECT_THROW(histogram.merge(Histogram{4, 0, 100}), std::invalid_argument);
+}
+
+TEST(TestStatistics, TestInvalidHistogram)
+{
+    EXPECT_THROW(std::ignore = range(0, 5).histogram(0, 0, 1), std::length_error);
+    EXPECT_THROW(std::ignore = range(0, 5).histogram(2, 1, 1), std::invalid_argument);
+}
+
+TEST(TestStatistics, TestQuantilesOfUniformDistribution)
+{
+    auto result = range(0, 100'001).quantiles({0.0, 0.01, 0.5, 0.99, 1.0});
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_DOUBLE_EQ(result.value()[0], 0);
+    EXPECT_NEAR(result.value()[1], 1000, 20);
+    EXPECT_NEAR(result.value()[2], 50'000, 500);
+    EXPECT_NEAR(result.value()[3], 99'000, 20);
+    EXPECT_DOUBLE_EQ(result.value()[4], 100'000);
+}
+
+TEST(TestStatistics, TestQuantilesOfShuffledData)
+{
+    auto values = range(0, 200'000).map([](auto x) { return static_cast<double>(x); }).collect();
+    std::ranges::shuffle(values, std::mt19937{42});
+
+    auto result = LazyIterator{values}.quantiles({0.001, 0.5, 0.999});
+
+    // Rank error near the tails is bounded by the size of the outer centroids.
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NEAR(result.value()[0], 200, 100);
+    EXPECT_NEAR(result.value()[1], 100'000, 1000);
+    EXPECT_NEAR(result.value()[2], 199'800, 100);
+}
+
+TEST(TestStatistics, TestQuantilesOfEmptyIterator)
+{
+    auto vec = std::vector<int>{};
+
+    EXPECT_EQ(LazyIterator{vec}.quantiles({0.5}), std::nullopt);
+}
+
+TEST(TestStatistics, TestQuantileOfSingleValue)
+{
+    auto vec    = std::vector{7};
+    auto result = LazyIterator{vec}.quantiles({0.1, 0.9});
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_THAT(result.value(), ElementsAreArray({7.0, 7.0}));
+}
+
+TEST(TestStatistics, TestInvalidQuantile)
+{
+    auto sketch = range(0, 10).digest();
+
+    EXPECT_THROW(std::ignore = sketch.quantile(1.5), std::invalid_argument);
+    EXPECT_THROW(TDigest{0}, std::invalid_argument);
+}
+
+TEST(TestStatistics, TestDigestOfManyValues)
+{
+    auto sketch = TDigest{50};
+
+    for (int i = 0; i < 1'000'000; i++)
+        sketch.add(i);
+
+    EXPECT_DOUBLE_EQ(sketch.count(), 1'000'000);
+    EXPECT_NEAR(sketch.quantile(0.25).value(), 250'000, 5000);
+}
+
+TEST(TestStatistics, TestMergeDigests)
+{
+    auto sketch = range(0, 50'000).digest();
+    sketch.merge(range(50'000, 100'000).digest());
+    sketch.merge(sketch);
+
+    EXPECT_DOUBLE_EQ(sketch.count(), 200'000);
+    EXPECT_NEAR(sketch.quantile(0.5).value(), 50'000, 1000);
+    EXPECT_DOUBLE_EQ(sketch.quantile(1).value(), 99'999);
+}
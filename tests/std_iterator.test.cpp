@@ -0,0 +1,75 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+
+#include <algorithm>
+#include <ranges>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestStdIterator, IteratorsAreInputRanges)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto it  = LazyIterator{vec}.map([](auto x) { return x * 2; });
+
+    static_assert(std::ranges::input_range<decltype(it)>);
+    static_assert(std::input_iterator<decltype(it.begin())>);
+}
+
+TEST(TestStdIterator, RangeForLoop)
+{
+    auto vec    = std::vector{1, 2, 3, 4};
+    auto result = std::vector<int>{};
+
+    for (auto x : LazyIterator{vec}.filter([](auto x) { return x % 2 == 0; }))
+        result.push_back(x);
+
+    EXPECT_THAT(result, ElementsAreArray({2, 4}));
+}
+
+TEST(TestStdIterator, RangeForLoopOnEmptyIterator)
+{
+    auto vec   = std::vector<int>{};
+    auto count = 0;
+
+    for (auto _ : LazyIterator{vec})
+        count += 1;
+
+    ASSERT_EQ(count, 0);
+}
+
+TEST(TestStdIterator, RangesAlgorithms)
+{
+    auto vec = std::vector{1, 2, 3, 4, 5};
+    auto it  = LazyIterator{vec}.map([](auto x) { return x * x; });
+
+    ASSERT_EQ(std::ranges::count_if(it, [](auto x) { return x > 5; }), 3);
+}
+
+TEST(TestStdIterator, PassIteratorToViews)
+{
+    auto vec    = std::vector{1, 2, 3, 4};
+    auto it     = LazyIterator{vec}.map([](auto x) { return x + 1; });
+    auto result = std::vector<int>{};
+
+    for (auto x : it | std::views::transform([](auto x) { return x * 10; }) | std::views::take(2))
+        result.push_back(x);
+
+    EXPECT_THAT(result, ElementsAreArray({20, 30}));
+}
+
+TEST(TestStdIterator, ResumesPartiallyConsumedIterator)
+{
+    auto vec    = std::vector{1, 2, 3};
+    auto it     = LazyIterator{vec};
+    auto result = std::vector<int>{};
+
+    it.next();
+
+    for (auto x : it)
+        result.push_back(x);
+
+    EXPECT_THAT(result, ElementsAreArray({2, 3}));
+}
@@ -0,0 +1,34 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/successors.hpp>
+
+#include <optional>
+
+using ::rusty_iterators::iterator::successors;
+using ::testing::ElementsAreArray;
+
+TEST(TestSuccessorsIterator, YieldUntilEmpty)
+{
+    auto it = successors(1, [](const int& x) -> std::optional<int> {
+        if (x >= 100)
+            return std::nullopt;
+        return x * 3;
+    });
+
+    EXPECT_THAT(it.collect(), ElementsAreArray(std::array{1, 3, 9, 27, 81, 243}));
+}
+
+TEST(TestSuccessorsIterator, InfiniteSequence)
+{
+    auto it = successors(1, [](auto x) { return std::make_optional(x * 2); });
+
+    EXPECT_THAT(it.take(4).collect(), ElementsAreArray(std::array{1, 2, 4, 8}));
+}
+
+TEST(TestSuccessorsIterator, SizeHintIsUnknown)
+{
+    auto it = successors(1, [](auto x) { return std::make_optional(x); });
+
+    ASSERT_EQ(it.sizeHint(), 0);
+}
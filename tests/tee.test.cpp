@@ -0,0 +1,103 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rusty_iterators/iterator.hpp>
+
+#include <ranges>
+#include <stdexcept>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::testing::ElementsAreArray;
+
+TEST(TestTeeIterator, EveryConsumerGetsAllItems)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto its = LazyIterator{vec}.map([](auto x) { return x * 2; }).tee(3);
+
+    ASSERT_EQ(its.size(), 3);
+
+    for (auto& it : its)
+        EXPECT_THAT(it.collect(), ElementsAreArray(std::array{2, 4, 6}));
+}
+
+TEST(TestTeeIterator, InterleavedConsumption)
+{
+    auto vec = std::vector<std::string>{"a", "b", "c"};
+    auto its = LazyIterator{vec}.map([](const std::string& x) { return x + x; }).tee(2);
+
+    ASSERT_EQ(its[0].next(), "aa");
+    ASSERT_EQ(its[1].next(), "aa");
+    ASSERT_EQ(its[1].next(), "bb");
+    ASSERT_EQ(its[1].next(), "cc");
+    ASSERT_EQ(its[1].next(), std::nullopt);
+    ASSERT_EQ(its[0].next(), "bb");
+    ASSERT_EQ(its[0].next(), "cc");
+    ASSERT_EQ(its[0].next(), std::nullopt);
+}
+
+TEST(TestTeeIterator, UpstreamIsConsumedOnce)
+{
+    auto pulled = 0;
+    auto its    = LazyIterator{std::views::iota(1, 5)}
+                   .inspect([&pulled](auto _) { pulled++; })
+                   .tee(2);
+
+    ASSERT_EQ(its[0].sum(), 10);
+    ASSERT_EQ(its[1].max(), 4);
+    ASSERT_EQ(pulled, 4);
+}
+
+TEST(TestTeeIterator, SizeHintIncludesBufferedItems)
+{
+    auto vec = std::vector{1, 2, 3};
+    auto its = LazyIterator{vec}.tee(2);
+
+    its[0].next();
+    its[0].next();
+
+    ASSERT_EQ(its[0].sizeHint(), 1);
+    ASSERT_EQ(its[1].sizeHint(), 3);
+}
+
+TEST(TestTeeIterator, ThrowWhenBufferLimitIsExceeded)
+{
+    auto vec = std::vector{1, 2, 3, 4};
+    auto its = LazyIterator{vec}.tee(2, 2);
+
+    ASSERT_EQ(its[0].next(), 1);
+    ASSERT_EQ(its[0].next(), 2);
+    EXPECT_THROW(its[0].next(), std::length_error);
+
+    // Slower consumer catches up and the faster one can continue.
+    ASSERT_EQ(its[1].next(), 1);
+    ASSERT_EQ(its[0].next(), 3);
+    EXPECT_THAT(its[1].collect(), ElementsAreArray(std::array{2, 3, 4}));
+    ASSERT_EQ(its[0].next(), 4);
+}
+
+TEST(TestTeeIterator, DroppedConsumerDoesNotHoldItems)
+{
+    auto vec = std::vector{1, 2, 3, 4};
+    auto its = LazyIterator{vec}.tee(2, 1);
+
+    its.pop_back();
+
+    EXPECT_THAT(its[0].collect(), ElementsAreArray(std::array{1, 2, 3, 4}));
+}
+
+TEST(TestTeeIterator, ZeroConsumersThrows)
+{
+    auto vec = std::vector{1, 2, 3};
+
+    EXPECT_THROW(std::ignore = LazyIterator{vec}.tee(0), std::length_error);
+}
+
+TEST(TestTeeIterator, ConsumersComposeWithAdapters)
+{
+    auto its   = LazyIterator{std::views::iota(0, 10)}.tee(2);
+    auto evens = std::move(its[0]).filter([](auto x) { return x % 2 == 0; });
+    auto odds  = std::move(its[1]).filter([](auto x) { return x % 2 == 1; });
+
+    ASSERT_EQ(evens.zip(std::move(odds)).count(), 5);
+}
@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+
+using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::rusty_iterators::statistics::TopK;
+using ::testing::ElementsAreArray;
+
+TEST(TestTopK, TestTopK)
+{
+    auto vec    = std::vector{5, 1, 9, 3, 7, 9, 2};
+    auto result = LazyIterator{vec}.topK(3);
+
+    EXPECT_THAT(result, ElementsAreArray({9, 9, 7}));
+}
+
+TEST(TestTopK, TestBottomK)
+{
+    auto vec    = std::vector{5, 1, 9, 3, 7, 9, 2};
+    auto result = LazyIterator{vec}.bottomK(3);
+
+    EXPECT_THAT(result, ElementsAreArray({1, 2, 3}));
+}
+
+TEST(TestTopK, TestKBiggerThanIterator)
+{
+    auto vec = std::vector{2, 3, 1};
+
+    EXPECT_THAT(LazyIterator{vec}.topK(10), ElementsAreArray({3, 2, 1}));
+    EXPECT_TRUE(LazyIterator{vec}.topK(0).empty());
+}
+
+TEST(TestTopK, TestTopKOfStrings)
+{
+    auto vec    = std::vector<std::string>{"pear", "apple", "plum", "fig"};
+    auto result = LazyIterator{vec}.bottomK(2);
+    auto owned  = std::vector<std::string>(result.begin(), result.end());
+
+    EXPECT_THAT(owned, ElementsAreArray({"apple", "fig"}));
+}
+
+TEST(TestTopK, TestTopKByIsStable)
+{
+    auto vec    = std::vector<std::string>{"ab", "xyz", "cd", "uvw", "ef", "q"};
+    auto result = LazyIterator{vec}.topKBy(3, [](const auto& x) { return x.get().size(); });
+    auto owned  = std::vector<std::string>(result.begin(), result.end());
+
+    EXPECT_THAT(owned, ElementsAreArray({"xyz", "uvw", "ab"}));
+}
+
+TEST(TestTopK, TestTopKMatchesSort)
+{
+    auto values = range(0, 10'000).map([](auto x) { return (x * 7919) % 1009; }).collect();
+
+    auto expected = values;
+    std::ranges::sort(expected, std::ranges::greater{});
+    expected.resize(25);
+
+    EXPECT_THAT(LazyIterator{values}.topK(25), ElementsAreArray(expected));
+}
+
+TEST(TestTopK, TestMergeTopK)
+{
+    auto first  = TopK<std::pair<int, char>, decltype(&std::pair<int, char>::first)>{
+        2, &std::pair<int, char>::first};
+    auto second = first;
+
+    first.add({1, 'a'});
+    first.add({5, 'b'});
+    second.add({5, 'c'});
+    second.add({3, 'd'});
+
+    second.merge(first);
+    auto result = second.sorted();
+
+    // Merged items count as the later ones, so ties keep ours.
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].second, 'c');
+    EXPECT_EQ(result[1].second, 'b');
+}
@@ -2,8 +2,13 @@
 #include <gtest/gtest.h>
 
 #include <rusty_iterators/iterator.hpp>
+#include <rusty_iterators/range.hpp>
+#include <string>
+#include <type_traits>
 
 using ::rusty_iterators::iterator::LazyIterator;
+using ::rusty_iterators::iterator::range;
+using ::testing::ElementsAreArray;
 using ::testing::FieldsAre;
 
 TEST(TestZipIterator, TestCollectedTuples)
@@ -82,3 +87,52 @@ TEST(TestZipIterator, TestAdvanceBy)
 
     EXPECT_THAT(it.next().value(), FieldsAre(3, 6));
 }
+
+TEST(TestZipIterator, TestZipManyYieldsFlatTuples)
+{
+    auto names = std::vector<std::string>{"a", "b", "c"};
+    auto it    = range(0, 10).zip(LazyIterator{names}, range(10, 20), range(0, 20, 5));
+
+    auto item = it.next().value();
+
+    static_assert(std::tuple_size_v<decltype(item)> == 4);
+    EXPECT_EQ(std::get<0>(item), 0);
+    EXPECT_EQ(std::get<1>(item).get(), "a");
+    EXPECT_EQ(std::get<2>(item), 10);
+    EXPECT_EQ(it.sizeHint(), 2);
+}
+
+TEST(TestZipIterator, TestZipManyEndsWithTheShortest)
+{
+    auto it = range(0, 10).zip(range(0, 3), range(0, 10).cycle());
+
+    it.advanceBy(1);
+
+    EXPECT_THAT(it.next().value(), FieldsAre(1, 1, 1));
+    EXPECT_THAT(it.next().value(), FieldsAre(2, 2, 2));
+    EXPECT_EQ(it.next(), std::nullopt);
+    EXPECT_EQ(range(0, 1).cycle().zip(range(0, 1).cycle(), range(0, 1).cycle()).sizeHint(),
+              std::nullopt);
+}
+
+TEST(TestZipIterator, TestCollectSoA)
+{
+    auto ids    = std::vector{1, 2, 3};
+    auto prices = std::vector{1.5, 2.5, 3.5};
+
+    auto [a, b, c] = LazyIterator{ids}.zip(LazyIterator{prices}, range(0, 3)).collectSoA();
+
+    static_assert(std::is_same_v<decltype(a), std::vector<int>>);
+    static_assert(std::is_same_v<decltype(b), std::vector<double>>);
+    EXPECT_THAT(a, ElementsAreArray(ids));
+    EXPECT_THAT(b, ElementsAreArray(prices));
+    EXPECT_THAT(c, ElementsAreArray({0, 1, 2}));
+}
+
+TEST(TestZipIterator, TestUnzipMany)
+{
+    auto [a, b, c, d] = range(0, 4).zip(range(4, 8), range(8, 12), range(12, 16)).unzip();
+
+    EXPECT_THAT(a, ElementsAreArray({0, 1, 2, 3}));
+    EXPECT_THAT(d, ElementsAreArray({12, 13, 14, 15}));
+}